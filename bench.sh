@@ -0,0 +1,71 @@
+#!/bin/sh
+# simulator ó ӵ benchmark
+# event engine(main.c) tick engine(main2.c) build  workload ũ⸶ main.c workload  ϳ 
+#  engine   (-f) --bench ϰ,
+#  JSON ϳ   (  񱳿 commit, ¥ )
+#
+# usage: ./bench.sh [output.json]
+#
+# ȯ 
+#   SIZES       process   (⺻: 10 100 1000 10000 100000 1000000 10000000)
+#   TICK_MAX    tick engine  ִ process  (⺻: 10000)
+#               tick engine idle  ǳʶٰ    tick ϸ,
+#               SJF Priority  tick ready queue ü Ƿ process   ð ũ þ
+#   SEED        workload seed (⺻: 1)
+#   WORKLOAD_ARGS  workload  option (: "--arrival exp:4 --burst lognormal")
+#   EVENT_ARGS  event engine ߰ ѱ option (: "-e wheel")
+#
+#  engine event ǰ ٸǷ ó dispatch(ready queue process  CPU Ҵ Ƚ) ð 
+#   CC, CFLAGS  compiler option (⺻: cc, -O2)
+
+set -e
+
+SIZES=${SIZES:-"10 100 1000 10000 100000 1000000 10000000"}
+TICK_MAX=${TICK_MAX:-10000}
+SEED=${SEED:-1}
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+
+cd "$(dirname "$0")"
+
+build=$(mktemp -d)
+trap 'rm -rf "$build"' EXIT
+
+$CC $CFLAGS -pthread -o "$build/event" main.c -lm
+$CC $CFLAGS -o "$build/tick" main2.c
+
+commit=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+date=$(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+# run ϳ JSON runs 迭 ߰
+runs=""
+add_run() {
+    if [ -n "$runs" ]; then
+        runs="$runs,
+    $1"
+    else
+        runs="    $1"
+    fi
+}
+
+for n in $SIZES; do
+    "$build/event" --export-workload "$build/workload.wl" -n "$n" -s "$SEED" $WORKLOAD_ARGS > /dev/null
+
+    echo "event engine: $n processes" >&2
+    add_run "$("$build/event" --bench -f "$build/workload.wl" $EVENT_ARGS)"
+
+    if [ "$n" -le "$TICK_MAX" ]; then
+        echo "tick engine: $n processes" >&2
+        add_run "$("$build/tick" --bench -f "$build/workload.wl")"
+    fi
+done
+
+result="{\"commit\":\"$commit\",\"date\":\"$date\",\"cflags\":\"$CFLAGS\",\"seed\":$SEED,\"workload_args\":\"$WORKLOAD_ARGS\",\"runs\":[
+$runs
+]}"
+
+if [ -n "$1" ]; then
+    echo "$result" > "$1"
+else
+    echo "$result"
+fi
@@ -0,0 +1,184 @@
+#!/bin/sh
+# event engine(main.c) tick engine(main2.c)  ˻, ӵ 
+#  workload   engine --dump ؼ ˰򺰷 process /Ϸ    ϰ,
+#  ū workload  engine --bench ؼ ˰  ð  
+#
+# usage: ./compare_engines.sh
+#
+# ȯ 
+#   N         workload process  (⺻: 50)
+#   SEEDS    workload seed  (⺻: 1 ~ 20)
+#   QUANTUM  Round Robin time quantum (⺻: 3)
+#   ARRIVAL_RANGE   ð  0 ~ ARRIVAL_RANGE-1 (⺻: 10, main.c uniform workload )
+#   BENCH_N  ӵ 񱳿 workload process  (⺻: 5000, 0̸ )
+#   CC, CFLAGS  compiler option (⺻: cc, -O2)
+#
+#  engine      óϹǷ  ִ workload  ƾ 
+#   -   , I/O Ϸ(I/O request ), time quantum ų preemption process  ready queue 
+#   -  cpu burst priority   ready queue  process õǰ,   process  ۰ų  process   preemption
+#
+# ϳ ٸ exit status 1
+
+set -e
+
+N=${N:-50}
+SEEDS=${SEEDS:-"1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20"}
+QUANTUM=${QUANTUM:-3}
+ARRIVAL_RANGE=${ARRIVAL_RANGE:-10}
+BENCH_N=${BENCH_N:-5000}
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+
+cd "$(dirname "$0")"
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+$CC $CFLAGS -pthread -o "$work/event" main.c -lm
+$CC $CFLAGS -o "$work/tick" main2.c
+
+# seed process n workload   ( ð ܿ main.c uniform workload  )
+make_workload() {
+    awk -v seed="$1" -v n="$2" -v arrival_range="$ARRIVAL_RANGE" 'BEGIN {
+        srand(seed)
+        print "PID,Priority,Arrival,CPU_Burst,IO_Request,IO_Burst"
+
+        for (i = 1; i <= n; i++) {
+            cpu = int(rand() * 9) + 2
+            printf "%d,%d,%d,%d,%d,%d\n", i, int(rand() * 5) + 1, int(rand() * arrival_range), cpu, int(rand() * (cpu - 1)) + 1, int(rand() * 5) + 1
+        }
+    }' > "$work/workload.csv"
+
+    "$work/event" --import-csv "$work/workload.csv" "$3" > /dev/null
+}
+
+#  dump ˰򺰷 ؼ "policy|Ϸ  ٸ process |   |ù " 
+compare_dumps() {
+    awk -v seed="$1" '
+        FNR == 1 { file++ }
+        $1 == "policy" {
+            policy = substr($0, 8)
+            i = 0
+            if (file == 1) {
+                order[++policies] = policy
+            }
+            next
+        }
+        file == 1 {
+            line[policy, ++i] = $0
+            count[policy] = i
+            next
+        }
+        {
+            i++
+            seen[policy] = i
+
+            if (line[policy, i] != $0) {
+                if ($1 == "process") {
+                    processes[policy]++
+                }
+                else {
+                    runs[policy] = 1
+                }
+
+                if (!(policy in first)) {
+                    first[policy] = "seed " seed ": event \"" line[policy, i] "\", tick \"" $0 "\""
+                }
+            }
+        }
+        END {
+            for (k = 1; k <= policies; k++) {
+                p = order[k]
+
+                if (seen[p] != count[p]) {
+                    runs[p] = 1
+
+                    if (!(p in first)) {
+                        first[p] = "seed " seed ": timeline length " count[p] " vs " seen[p]
+                    }
+                }
+
+                printf "%s|%d|%d|%s\n", p, processes[p], runs[p], first[p]
+            }
+        }' "$2" "$3"
+}
+
+: > "$work/results"
+
+for seed in $SEEDS; do
+    make_workload "$seed" "$N" "$work/workload.wl"
+
+    "$work/event" -f "$work/workload.wl" -t "$QUANTUM" --dump > "$work/event.txt"
+    "$work/tick" -f "$work/workload.wl" -t "$QUANTUM" --dump > "$work/tick.txt"
+
+    compare_dumps "$seed" "$work/event.txt" "$work/tick.txt" >> "$work/results"
+done
+
+echo "Equivalence: $N processes, seeds $SEEDS, quantum $QUANTUM, arrivals 0-$((ARRIVAL_RANGE - 1))"
+
+# ˰򺰷  seed  ħ
+awk -F'|' -v workloads="$(echo $SEEDS | wc -w)" -v n="$N" '
+    !($1 in same) {
+        order[++policies] = $1
+        same[$1] = 0
+    }
+    {
+        processes[$1] += $2
+
+        if ($2 == 0 && $3 == 0) {
+            same[$1]++
+        }
+        else if (!($1 in first)) {
+            first[$1] = $4
+        }
+    }
+    END {
+        printf "%-24s  %9s  %16s\n", "Policy", "Identical", "Completion diffs"
+
+        for (k = 1; k <= policies; k++) {
+            p = order[k]
+            printf "%-24s  %9s  %16s\n", p, same[p] "/" workloads, processes[p] "/" workloads * n
+
+            if (p in first) {
+                printf "    first difference: %s\n", first[p]
+            }
+        }
+    }' "$work/results"
+
+if [ "$BENCH_N" -gt 0 ]; then
+    make_workload 1 "$BENCH_N" "$work/bench.wl"
+
+    # --bench JSON "policy|seconds" 
+    seconds() {
+        awk '{
+            n = split($0, part, "\\{\"policy\":\"")
+
+            for (k = 2; k <= n; k++) {
+                split(part[k], field, "\"")
+                match(part[k], /"seconds":[0-9.]+/)
+                print field[1] "|" substr(part[k], RSTART + 10, RLENGTH - 10)
+            }
+        }'
+    }
+
+    "$work/event" -f "$work/bench.wl" -t "$QUANTUM" --bench | seconds > "$work/event.bench"
+    "$work/tick" -f "$work/bench.wl" -t "$QUANTUM" --bench | seconds > "$work/tick.bench"
+
+    echo
+    echo "Speed: $BENCH_N processes (seconds)"
+
+    awk -F'|' '
+        FNR == NR {
+            event[$1] = $2
+            next
+        }
+        FNR == 1 {
+            printf "%-24s  %10s  %10s  %10s\n", "Policy", "Event", "Tick", "Tick/Event"
+        }
+        {
+            printf "%-24s  %10.6f  %10.6f  %9.1fx\n", $1, event[$1], $2, (event[$1] > 0 ? $2 / event[$1] : 0)
+        }' "$work/event.bench" "$work/tick.bench"
+fi
+
+# ٸ ˰  
+! awk -F'|' '$2 != 0 || $3 != 0 { found = 1 } END { exit !found }' "$work/results"
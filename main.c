@@ -1,51 +1,289 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <math.h>
 #include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(SIM_STATS) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+
+#define DEFAULT_PROCESS_COUNT 5
+#define DEFAULT_TIME_QUANTUM 3
+#define MAX_SWEEP_CONTEXT_SWITCHES 16
+#define DEFAULT_OPEN_HORIZON 1000000
+#define DEFAULT_OPEN_POOL_SIZE 65536
+#define DEFAULT_OPEN_ARRIVAL_MEAN 8.0
+#define MAX_OPEN_HORIZON 2000000000
+#define MAX_ARRIVAL_TIME (MAX_OPEN_HORIZON + 1) // ϴ    (burst ص int  )
+#define DEFAULT_BENCH_PROCESS_COUNT 100000
+
+
+// malloc, calloc, realloc ȣ Ƚ (--bench )
+long long allocation_count = 0;
+
+// Ҵ Ƚ  malloc, calloc, realloc (ϸ NULL ״ ȯ)
+void* xmalloc(size_t size) {
+    __atomic_fetch_add(&allocation_count, 1, __ATOMIC_RELAXED);
+    return malloc(size);
+}
+
+void* xcalloc(size_t count, size_t size) {
+    __atomic_fetch_add(&allocation_count, 1, __ATOMIC_RELAXED);
+    return calloc(count, size);
+}
+
+void* xrealloc(void* p, size_t size) {
+    __atomic_fetch_add(&allocation_count, 1, __ATOMIC_RELAXED);
+    return realloc(p, size);
+}
+
+// ݱ  ִ  ޸ (KB,    0)
+long peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_maxrss;
+    }
+#endif
 
+    return 0;
+}
 
-#define PROCESS_COUNT 5
-#define QUEUE_SIZE (PROCESS_COUNT + 1)
-#define MAX_TIME 100
-#define TIME_QUANTUM 3
-#define MAX_EVENTS 100
 
+// hot path : -DSIM_STATS compileϸ run Ƚ cycle  evaluation, --bench 
+// ⺻ build SIM_STAT(...)    ŵǹǷ  
+#ifdef SIM_STATS
+#define SIM_STAT(statement) statement
+
+// cycle counter (x86 ܿ ns)
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000 + (uint64_t)t.tv_nsec;
+#endif
+}
 
 typedef struct {
+    long long events_pushed;
+    long long events_popped;
+    long long stale_events; // preemption ҵǾ  CPU complete event
+    long long purges; // ҵ event  event queue  Ƚ
+    long long preemptions;
+    long long context_switches; //  ٸ process CPU Ҵ
+    uint64_t pop_cycles; // event queue pop
+    uint64_t dispatch_cycles; // preemption ˻  process 
+    uint64_t timeline_cycles; // gantt chart 
+} Sim_Stats;
+#else
+#define SIM_STAT(statement)
+#endif
+
+
+typedef struct Process {
     int pid;
     int priority;
     int arrival_time;
     int cpu_burst;
     int io_burst;
     int io_request_time;
-    int start_time;
-    int completion_time;
-    int waiting_time;
-    int turnaround_time;
     int remaining_cpu;
     int remaining_io;
     int executed_time;
+    int heap_index; // ready heap  ġ (heap  -1)
+    struct Process* wait_prev; // waiting queue   process
+    struct Process* wait_next; // waiting queue   process
+    bool waiting; // waiting queue ִ 
 } Process;
 
+#define CACHE_LINE 64
+#define ARENA_INITIAL_SIZE (64 * 1024)
+
+// run ϳ ϴ queue, heap, event queue, gantt chart  ߶ ִ memory 
+// run   ʰ ó ٽ ϹǷ, ũⰡ  ڿ malloc Ͼ 
+typedef struct {
+    void* block; // malloc   ּ (free)
+    char* base; // CACHE_LINE 迡   ּ
+    size_t capacity;
+    size_t used;
+
+    // base    Ҵ block, reset ϰ ׸ŭ base Ű
+    void** overflow;
+    int overflow_count;
+    int overflow_capacity;
+    size_t overflow_bytes;
+} Arena;
+
 typedef struct {
     Process** process;
+    Arena* arena;
     int capacity;
     int front;
     int rear;
     int count;
+#ifdef SIM_STATS
+    long long expansions;
+#endif
 } Process_Queue;
 
-Process_Queue ready_queue;
-Process_Queue waiting_queue;
+// IO  process   list (Process wait_prev, wait_next )
+typedef struct {
+    Process* head;
+    Process* tail;
+    int count;
+} Waiting_Queue;
+
+typedef struct {
+    Process* p;
+    int key; //   
+    int seq; // heap   (key    process 켱)
+} Heap_Node;
+
+typedef struct {
+    Heap_Node* node;
+    Arena* arena;
+    int capacity;
+    int count;
+    int next_seq;
+#ifdef SIM_STATS
+    long long expansions;
+    long long sift_steps; // push, pop, ġ   node ű Ƚ (ready  )
+#endif
+} Process_Heap;
+
+// process  (column)  迭 и (Structure of Arrays)
+// ʱȭ evaluation Process ü ƴ ʿ 迭  а  
+typedef struct {
+    int* arrival_time;
+    int* service_time; // cpu_burst + io_burst
+    int* start_time;
+    int* completion_time;
+    int* waiting_time;
+    int* turnaround_time;
+} Process_Table;
+
+typedef struct {
+    long long sum;
+    int min;
+    int max;
+} Metric_Summary;
+
+size_t arena_round(size_t bytes) {
+    return (bytes + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1);
+}
+
+// CACHE_LINE 迡  bytes ũ  Ҵ,   ּҴ *block 
+char* arena_block(size_t bytes, void** block) {
+    *block = xmalloc(bytes + CACHE_LINE);
+
+    if (!*block) {
+        fprintf(stderr, "arena: out of memory (%zu bytes)\n", bytes);
+        exit(1);
+    }
+
+    return (char*)(((uintptr_t)*block + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1));
+}
+
+void arena_init(Arena* a, size_t capacity) {
+    a->block = NULL;
+    a->base = capacity > 0 ? arena_block(capacity, &a->block) : NULL;
+    a->capacity = capacity;
+    a->used = 0;
+
+    a->overflow = NULL;
+    a->overflow_count = 0;
+    a->overflow_capacity = 0;
+    a->overflow_bytes = 0;
+}
+
+void* arena_alloc(Arena* a, size_t bytes) {
+    bytes = arena_round(bytes);
+
+    if (a->used + bytes <= a->capacity) {
+        void* p = a->base + a->used;
+        a->used += bytes;
+        return p;
+    }
+
+    // ̹ run  Ҵϰ,  runʹ base ϳ  reset Ű
+    if (a->overflow_count == a->overflow_capacity) {
+        int new_capacity = a->overflow_capacity ? a->overflow_capacity * 2 : 16;
+        void** new_overflow = xrealloc(a->overflow, sizeof(void*) * new_capacity);
+
+        if (!new_overflow) {
+            fprintf(stderr, "arena: out of memory (%d blocks)\n", new_capacity);
+            exit(1);
+        }
+
+        a->overflow = new_overflow;
+        a->overflow_capacity = new_capacity;
+    }
+
+    a->overflow_bytes += bytes;
+
+    return arena_block(bytes, &a->overflow[a->overflow_count++]);
+}
+
+// Ҵ   ݳϰ ó ٽ  (  pointer  ȿ)
+void arena_reset(Arena* a) {
+    if (a->overflow_count > 0) {
+        //  run  ü ũⰡ  block  Ȯ
+        size_t capacity = a->capacity + a->overflow_bytes;
 
-Process process_list[PROCESS_COUNT];
+        for (int i = 0; i < a->overflow_count; i++) {
+            free(a->overflow[i]);
+        }
+
+        free(a->block);
+
+        a->base = arena_block(capacity, &a->block);
+        a->capacity = capacity;
+        a->overflow_count = 0;
+        a->overflow_bytes = 0;
+    }
+
+    a->used = 0;
+}
+
+void arena_free(Arena* a) {
+    for (int i = 0; i < a->overflow_count; i++) {
+        free(a->overflow[i]);
+    }
 
-void init(Process_Queue* q, int initial_capacity) {
-    q->process = malloc(sizeof(Process*) * initial_capacity);
+    free(a->overflow);
+    free(a->block);
+}
+
+
+void init(Process_Queue* q, int initial_capacity, Arena* arena) {
+    q->arena = arena;
+    q->process = arena_alloc(arena, sizeof(Process*) * initial_capacity);
     q->capacity = initial_capacity;
     q->front = 0;
     q->rear = 0;
     q->count = 0;
+    SIM_STAT(q->expansions = 0);
 }
 
 bool is_empty(Process_Queue* q) {
@@ -59,7 +297,9 @@ bool is_full(Process_Queue* q) {
 void expand_queue(Process_Queue* q) {
     int previous_capacity = q->capacity;
     int new_capacity = previous_capacity * 2;
-    Process** new_process = malloc(sizeof(Process*) * new_capacity);
+    Process** new_process = arena_alloc(q->arena, sizeof(Process*) * new_capacity);
+
+    SIM_STAT(q->expansions++);
 
     int length = (previous_capacity + q->rear - q->front) % previous_capacity;
 
@@ -67,8 +307,7 @@ void expand_queue(Process_Queue* q) {
         new_process[i] = q->process[(q->front + i) % previous_capacity];
     }
 
-    free(q->process);
-
+    //  buffer arena reset  Բ ݳ
     q->process = new_process;
     q->capacity = new_capacity;
     q->front = 0;
@@ -104,570 +343,2639 @@ Process* dequeue(Process_Queue* q) {
     return p;
 }
 
-void dequeue_from_waiting_queue(Process_Queue* q, Process* p) {
-    int idx = q->front;
-    int target = -1;
-
-    if (q->count == 0) {
-        return;
-    }
-
-    // process p ť ִ ˻
-    for (int i = 0; i < q->count; i++) {
-        if (q->process[idx] == p) {
-            target = idx;
+void waiting_init(Waiting_Queue* q) {
+    q->head = NULL;
+    q->tail = NULL;
+    q->count = 0;
+}
 
-            break;
-        }
+void waiting_enqueue(Waiting_Queue* q, Process* p) {
+    p->wait_prev = q->tail;
+    p->wait_next = NULL;
+    p->waiting = true;
 
-        idx = (idx + 1) % q->capacity;
+    if (q->tail) {
+        q->tail->wait_next = p;
+    }
+    else {
+        q->head = p;
     }
 
-    if (target == -1) {
+    q->tail = p;
+    q->count++;
+}
+
+// process p waiting queue , Ž  p link 
+void dequeue_from_waiting_queue(Waiting_Queue* q, Process* p) {
+    if (!p->waiting) {
         return;
     }
 
-    int index = target;
-
-    // process p queue 
-    while (index != q->rear) {
-        int next = (index + 1) % q->capacity;
-        q->process[index] = q->process[next];
-        index = next;
+    if (p->wait_prev) {
+        p->wait_prev->wait_next = p->wait_next;
+    }
+    else {
+        q->head = p->wait_next;
     }
 
-    // queue rear, count 
-    if (q->rear == 0) {
-        q->rear = q->capacity - 1;
+    if (p->wait_next) {
+        p->wait_next->wait_prev = p->wait_prev;
     }
     else {
-        q->rear--;
+        q->tail = p->wait_prev;
     }
 
+    p->wait_prev = NULL;
+    p->wait_next = NULL;
+    p->waiting = false;
     q->count--;
+}
 
-    // queue  front, rear ʱȭ
-    if (q->count == 0) {
-        q->front = 0;
-        q->rear = 0;
-    }
+
+void heap_init(Process_Heap* h, int initial_capacity, Arena* arena) {
+    h->arena = arena;
+    h->node = arena_alloc(arena, sizeof(Heap_Node) * initial_capacity);
+    h->capacity = initial_capacity;
+    h->count = 0;
+    h->next_seq = 0;
+    SIM_STAT(h->expansions = 0);
+    SIM_STAT(h->sift_steps = 0);
 }
 
+bool heap_is_empty(Process_Heap* h) {
+    return h->count == 0;
+}
 
-typedef struct {
-    int time;
-    int type; // 1. Process Arrival  2. CPU Complete  3. IO Complete
-    Process* p;
-} Event_Heap;
+bool heap_less(Heap_Node* a, Heap_Node* b) {
+    if (a->key != b->key) {
+        return a->key < b->key;
+    }
 
-static Event_Heap event_heap[MAX_EVENTS + 1];
-static int event_count = 0;
+    return a->seq < b->seq;
+}
 
-void push_event(int time, int type, Process* p) {
-    if (event_count >= MAX_EVENTS) {
-        return;
+void expand_heap(Process_Heap* h) {
+    int new_capacity = h->capacity * 2;
+    Heap_Node* new_node = arena_alloc(h->arena, sizeof(Heap_Node) * new_capacity);
+
+    SIM_STAT(h->expansions++);
+
+    for (int i = 0; i < h->count; i++) {
+        new_node[i] = h->node[i];
     }
 
-    int index = ++event_count;
+    h->node = new_node;
+    h->capacity = new_capacity;
+}
+
+// index ġ node θ  ̵
+void heap_sift_up(Process_Heap* h, int index) {
+    Heap_Node target = h->node[index];
 
-    event_heap[index].time = time;
-    event_heap[index].type = type;
-    event_heap[index].p = p;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
 
-    while (index > 1) {
-        if (event_heap[index].time >= event_heap[index / 2].time) {
+        if (!heap_less(&target, &h->node[parent])) {
             break;
         }
-        else {
-            Event_Heap tmp = event_heap[index / 2];
-            event_heap[index / 2] = event_heap[index];
-            event_heap[index] = tmp;
-            index = index / 2;
-        }
+
+        h->node[index] = h->node[parent];
+        h->node[index].p->heap_index = index;
+        index = parent;
+        SIM_STAT(h->sift_steps++);
     }
+
+    h->node[index] = target;
+    target.p->heap_index = index;
 }
 
-Event_Heap pop_event() {
-    Event_Heap e = event_heap[1];
-    event_heap[1] = event_heap[event_count--];
-    int index = 1;
+// index ġ node ڽ  ̵
+void heap_sift_down(Process_Heap* h, int index) {
+    Heap_Node target = h->node[index];
 
     while (1) {
-        int left = 2 * index;
-        int right = 2 * index + 1;
-        int smallest = index;
+        int child = 2 * index + 1;
 
-        if (left <= event_count && event_heap[left].time < event_heap[smallest].time) {
-            smallest = left;
+        if (child >= h->count) {
+            break;
         }
 
-        if (right <= event_count && event_heap[right].time < event_heap[smallest].time) {
-            smallest = right;
+        if (child + 1 < h->count && heap_less(&h->node[child + 1], &h->node[child])) {
+            child++;
         }
 
-        if (smallest == index) {
+        if (!heap_less(&h->node[child], &target)) {
             break;
         }
-        else {
-            Event_Heap tmp = event_heap[index];
-            event_heap[index] = event_heap[smallest];
-            event_heap[smallest] = tmp;
-            index = smallest;
-        }
+
+        h->node[index] = h->node[child];
+        h->node[index].p->heap_index = index;
+        index = child;
+        SIM_STAT(h->sift_steps++);
     }
-    return e;
-}
 
+    h->node[index] = target;
+    target.p->heap_index = index;
+}
 
-int gantt[MAX_TIME];
-int gantt_io[MAX_TIME];
-int gantt_end = 0;
+int heap_node_compare(const void* a, const void* b) {
+    Heap_Node* x = (Heap_Node*)a;
+    Heap_Node* y = (Heap_Node*)b;
 
+    return heap_less(x, y) ? -1 : heap_less(y, x);
+}
 
-void create_process();
-void print_process_list();
-void initialization();
-void scheduling_FCFS();
-void scheduling_Non_Preemptive_SJF();
-void scheduling_Preemptive_SJF();
-void scheduling_Non_Preemptive_Priority();
-void scheduling_Preemptive_Priority();
-void scheduling_Round_Robin();
-void print_gantt();
-void evaluation();
+//   0 ٽ Űܼ next_seq int   ʵ 
+// ĵ 迭 ״ heap̰ node  
+void heap_renumber(Process_Heap* h) {
+    qsort(h->node, h->count, sizeof(Heap_Node), heap_node_compare);
 
+    for (int i = 0; i < h->count; i++) {
+        h->node[i].seq = i;
+        h->node[i].p->heap_index = i;
+    }
 
-int main(void) {
-    srand(time(NULL));
+    h->next_seq = h->count;
+}
 
-    create_process();
+void heap_push(Process_Heap* h, Process* p, int key) {
+    if (h->count == h->capacity) {
+        expand_heap(h);
+    }
 
-    print_process_list();
+    if (h->next_seq == INT_MAX) {
+        heap_renumber(h);
+    }
 
-    initialization();
-    printf("\nFCFS Scheduling\n");
-    scheduling_FCFS();
-    print_gantt();
-    evaluation();
+    int index = h->count++;
 
-    initialization();
-    printf("\nNon-Preemptive SJF Scheduling\n");
-    scheduling_Non_Preemptive_SJF();
-    print_gantt();
-    evaluation();
+    h->node[index].p = p;
+    h->node[index].key = key;
+    h->node[index].seq = h->next_seq++;
 
-    initialization();
-    printf("\nPreemptive SJF Scheduling\n");
-    scheduling_Preemptive_SJF();
-    print_gantt();
-    evaluation();
+    heap_sift_up(h, index);
+}
 
-    initialization();
-    printf("\nNon-Preemptive Priority Scheduling\n");
-    scheduling_Non_Preemptive_Priority();
-    print_gantt();
-    evaluation();
+Process* heap_peek(Process_Heap* h) {
+    if (heap_is_empty(h)) {
+        return NULL;
+    }
 
-    initialization();
-    printf("\nPreemptive Priority Scheduling\n");
-    scheduling_Preemptive_Priority();
-    print_gantt();
-    evaluation();
+    return h->node[0].p;
+}
 
-    initialization();
-    printf("\nRound Robin Scheduling\n");
-    scheduling_Round_Robin();
-    print_gantt();
-    evaluation();
+int heap_peek_key(Process_Heap* h) {
+    return h->node[0].key;
+}
 
-    free(ready_queue.process);
-    free(waiting_queue.process);
+// process p heap  (p->heap_index handle )
+void heap_remove(Process_Heap* h, Process* p) {
+    int index = p->heap_index;
 
-    return 0;
-}
+    if (index < 0) {
+        return;
+    }
 
+    p->heap_index = -1;
+    h->count--;
 
-void create_process() {
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
+    //  node  ڸ ä  ġ 
+    if (index != h->count) {
+        h->node[index] = h->node[h->count];
+        h->node[index].p->heap_index = index;
 
-        p->pid = i + 1; // 1 ~ 5
-        p->priority = rand() % 5 + 1; // 1 ~ 5
-        p->arrival_time = rand() % 10; // 0 ~ 9
-        p->cpu_burst = (rand() % 9) + 2; // 2 ~ 10
-        p->io_burst = (rand() % 5) + 1; // 1 ~ 5
-        p->io_request_time = (rand() % (p->cpu_burst - 1)) + 1; // 1 ~ (cpu_burst - 1), cpu burst  1 
-        p->start_time = -1;
-        p->completion_time = 0;
-        p->waiting_time = 0;
-        p->turnaround_time = 0;
-        p->remaining_cpu = p->cpu_burst;
-        p->remaining_io = 0;
-        p->executed_time = 0;
+        if (index > 0 && heap_less(&h->node[index], &h->node[(index - 1) / 2])) {
+            heap_sift_up(h, index);
+        }
+        else {
+            heap_sift_down(h, index);
+        }
     }
 }
 
-void print_process_list() {
-    printf("\nProcess List:\n");
-    printf("PID  Priority  Arrival  CPU_Burst  IO_Request  IO_Burst\n");
-
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
+Process* heap_pop(Process_Heap* h) {
+    Process* p = heap_peek(h);
 
-        printf("%3d  %8d  %7d  %9d  %10d  %8d\n", p->pid, p->priority, p->arrival_time, p->cpu_burst, p->io_request_time, p->io_burst);
+    if (p) {
+        heap_remove(h, p);
     }
+
+    return p;
 }
 
-void initialization() {
-    init(&ready_queue, QUEUE_SIZE);
-    init(&waiting_queue, QUEUE_SIZE);
 
-    event_count = 0;
+typedef struct {
+    int time;
+    int type; // 1. Process Arrival  2. CPU Complete  3. IO Complete
+    uint32_t generation; // push  process generation
+    Process* p;
+} Event_Heap;
+
+// event heap  Ǵ node (16 byte, cache line ϳ 4)
+typedef struct {
+    uint64_t key; //  32bit: time,  32bit: push  ( time̸  push event 켱)
+    uint32_t index; // process_list  process ġ
+    uint32_t type; //  EVENT_TYPE_BITS bit: event , : push  process generation
+} Event_Node;
+
+// process generation ٲ   push event ҵ  
+#define EVENT_TYPE_BITS 2
+#define EVENT_TYPE_MASK ((1u << EVENT_TYPE_BITS) - 1)
+#define EVENT_GENERATION_MASK (UINT32_MAX >> EVENT_TYPE_BITS)
+#define EVENT_PURGE_MIN 64 // ҵ event ̺  queue  
+
+#define EVENT_HEAP_ARITY 4
+#define EVENT_HEAP_PAD 3 // ڽ 4  cache line ̵ root տ δ node 
 
-    for (int i = 0; i < MAX_TIME; i++) {
-        gantt[i] = 0;
-        gantt_io[i] = 0;
-    }
+#define WHEEL_BITS 8
+#define WHEEL_SIZE (1 << WHEEL_BITS) // timing wheel slot  ( slot = 1 time unit)
+#define WHEEL_MASK (WHEEL_SIZE - 1)
 
-    gantt_end = 0;
+typedef enum {
+    EVENT_QUEUE_HEAP, // 4-ary heap, push/pop O(log n)
+    EVENT_QUEUE_WHEEL // timing wheel, push/pop amortized O(1)
+} Event_Queue_Type;
+
+typedef struct {
+    Event_Node e;
+    int next;
+} Wheel_Node;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->remaining_cpu = p->cpu_burst;
-        p->remaining_io = 0;
-        p->executed_time = 0;
-        p->start_time = -1;
-        p->completion_time = 0;
-        p->waiting_time = 0;
-        p->turnaround_time = 0;
+typedef struct {
+    Event_Queue_Type type;
+    int count; // ó  ü event 
+    int dead; // count  ҵǾ   ִ event 
+    uint32_t seq;
+    long long popped; // pop event  (ҵ event )
+#ifdef SIM_STATS
+    long long expansions; // heap, timing wheel node pool Ȯ
+#endif
+
+    // 4-ary heap (timing wheel   event overflow )
+    Arena* arena; // heap, pool buffer Ҵϴ 
+    Event_Node* heap;
+    int heap_capacity;
+    int heap_count;
+
+    // timing wheel
+    // [wheel_now, wheel_now + WHEEL_SIZE)  event slot FIFO list ΰ,
+    // ׺  event heap(overflow) ξٰ   slot ű.
+    Wheel_Node* pool;
+    int pool_capacity;
+    int pool_used;
+    int free_node; //   node list
+    int head[WHEEL_SIZE];
+    int tail[WHEEL_SIZE];
+    uint64_t bitmap[WHEEL_SIZE / 64]; // event ִ slot ǥ
+    int wheel_now; // wheel   
+    int wheel_count; // slot ִ event 
+} Event_Queue;
+
+void expand_event_heap(Event_Queue* q) {
+    int new_capacity = q->heap_capacity ? q->heap_capacity * 2 : 64;
+
+    // arena cache line 迡  ֹǷ PADŭ о root ġ
+    Event_Node* new_heap = (Event_Node*)arena_alloc(q->arena, sizeof(Event_Node) * (new_capacity + EVENT_HEAP_PAD)) + EVENT_HEAP_PAD;
+
+    SIM_STAT(q->expansions++);
+
+    for (int i = 0; i < q->heap_count; i++) {
+        new_heap[i] = q->heap[i];
     }
+
+    q->heap = new_heap;
+    q->heap_capacity = new_capacity;
 }
 
-// FCFS ˰
-void scheduling_FCFS() {
-    Process* executing_process = NULL;
+void event_heap_push(Event_Queue* q, Event_Node e) {
+    if (q->heap_count == q->heap_capacity) {
+        expand_event_heap(q);
+    }
 
-    int completed_process_count = 0;
-    int last_event_time = 0; //  ó event ߻ 
-    int last_run_start = 0; // executing_process   
+    Event_Node* heap = q->heap;
+    int index = q->heap_count++;
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
+    while (index > 0) {
+        int parent = (index - 1) / EVENT_HEAP_ARITY;
+
+        if (heap[parent].key <= e.key) {
+            break;
+        }
+
+        heap[index] = heap[parent];
+        index = parent;
     }
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
+    heap[index] = e;
+}
 
-        int now = e.time;
-        int to_io; // IO request  ð
-        int run; // CPU ۾  ð
+// index ġ node ΰ ڽĺ ۾  
+void event_heap_sift_down(Event_Queue* q, int index, Event_Node node) {
+    Event_Node* heap = q->heap;
+    int count = q->heap_count;
 
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
+    while (1) {
+        int first = EVENT_HEAP_ARITY * index + 1;
 
-            gantt_io[t] = 0;
+        if (first >= count) {
+            break;
         }
 
-        last_event_time = now;
+        int end = first + EVENT_HEAP_ARITY;
+        int smallest = first;
 
-        do {
-            Process* p = e.p;
+        if (end > count) {
+            end = count;
+        }
 
-            // 1. Process Arrival
-            if (e.type == 1) {
-                enqueue(&ready_queue, p);
+        for (int child = first + 1; child < end; child++) {
+            if (heap[child].key < heap[smallest].key) {
+                smallest = child;
             }
-            // 2. CPU Complete
-            else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
-
-                //  ֱٿ  cpu ۾ ð
-                p->executed_time += now - last_run_start;
-                p->remaining_cpu -= now - last_run_start;
+        }
 
-                // I/O request ߻ 
-                if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+        if (node.key <= heap[smallest].key) {
+            break;
+        }
 
-                    p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
-                    // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
-                }
-                //   process
-                else {
-                    p->completion_time = now;
-                    completed_process_count++;
-                }
+        heap[index] = heap[smallest];
+        index = smallest;
+    }
 
-                executing_process = NULL;
-            }
-            // 3. IO Complete
-            else if (e.type == 3) {
-                p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
-            }
+    heap[index] = node;
+}
 
-            // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
-            }
-            else {
-                break;
-            }
-        } while (1);
+Event_Node event_heap_pop(Event_Queue* q) {
+    Event_Node top = q->heap[0];
+    Event_Node last = q->heap[--q->heap_count];
 
-        // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            executing_process = dequeue(&ready_queue);
+    event_heap_sift_down(q, 0, last);
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
-            }
+    return top;
+}
 
-            to_io = executing_process->io_request_time - executing_process->executed_time;
+// event push   process generation ٲ ʾҴ
+bool event_node_live(Event_Node e, const uint32_t* generation) {
+    return (e.type >> EVENT_TYPE_BITS) == generation[e.index];
+}
 
-            // process IO ۾  ٽ CPU ۾ ϴ 
-            if (to_io <= 0) {
-                run = executing_process->remaining_cpu;
-            }
-            // process IO ۾    
-            else {
-                run = to_io;
-            }
+// ҵ event  heap ٽ ,  event  ȯ
+int event_heap_purge(Event_Queue* q, const uint32_t* generation) {
+    int count = 0;
 
-            // process ؾ ϴ ۾  
-            if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
-            }
-            // process  ϴ 
-            else {
-                executing_process->completion_time = now;
-                completed_process_count++;
-                executing_process = NULL;
-            }
+    for (int i = 0; i < q->heap_count; i++) {
+        if (event_node_live(q->heap[i], generation)) {
+            q->heap[count++] = q->heap[i];
         }
     }
 
-    gantt_end = last_event_time;
-
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
+    int removed = q->heap_count - count;
+    q->heap_count = count;
 
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
+    for (int i = (count - 2) / EVENT_HEAP_ARITY; count > 1 && i >= 0; i--) {
+        event_heap_sift_down(q, i, q->heap[i]);
     }
-}
 
-// Non-Preemptive SJF ˰
-void scheduling_Non_Preemptive_SJF() {
-    Process* executing_process = NULL;
-    int completed_process_count = 0;
-    int last_event_time = 0; //  ó event ߻ 
-    int last_run_start = 0; // executing_process   
+    return removed;
+}
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
+int wheel_alloc_node(Event_Queue* q) {
+    if (q->free_node >= 0) {
+        int index = q->free_node;
+        q->free_node = q->pool[index].next;
+        return index;
     }
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
-        int now = e.time;
-        int to_io; // IO request  ð
-        int run; // CPU ۾  ð
+    if (q->pool_used == q->pool_capacity) {
+        int new_capacity = q->pool_capacity ? q->pool_capacity * 2 : 64;
+        Wheel_Node* new_pool = arena_alloc(q->arena, sizeof(Wheel_Node) * new_capacity);
 
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
+        SIM_STAT(q->expansions++);
 
-            gantt_io[t] = 0;
+        if (q->pool_used > 0) {
+            memcpy(new_pool, q->pool, sizeof(Wheel_Node) * q->pool_used);
         }
 
-        last_event_time = now;
-
-        do {
-            Process* p = e.p;
+        q->pool = new_pool;
+        q->pool_capacity = new_capacity;
+    }
 
-            // 1. Process Arrival
-            if (e.type == 1) {
-                enqueue(&ready_queue, p);
-            }
-            // 2. CPU Complete
-            else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
+    return q->pool_used++;
+}
 
-                //  ֱٿ  cpu ۾ ð
-                p->executed_time += now - last_run_start;
-                p->remaining_cpu -= now - last_run_start;
+// event ش slot  ڿ ߰
+void wheel_append(Event_Queue* q, Event_Node e) {
+    int slot = (int)(e.key >> 32) & WHEEL_MASK;
+    int index = wheel_alloc_node(q);
 
-                // I/O request ߻ 
-                if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+    q->pool[index].e = e;
+    q->pool[index].next = -1;
 
-                    p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
-                    // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
+    if (q->head[slot] < 0) {
+        q->head[slot] = index;
+        q->bitmap[slot / 64] |= (uint64_t)1 << (slot % 64);
+    }
+    else {
+        q->pool[q->tail[slot]].next = index;
+    }
+
+    q->tail[slot] = index;
+    q->wheel_count++;
+}
+
+// start slot ȯϸ event ִ ù slot Ž
+int wheel_find_slot(Event_Queue* q, int start) {
+    for (int i = 0; i <= WHEEL_SIZE / 64; i++) {
+        int word = (start / 64 + i) % (WHEEL_SIZE / 64);
+        uint64_t bits = q->bitmap[word];
+
+        // ù word start  bit 
+        if (i == 0) {
+            bits &= ~(uint64_t)0 << (start % 64);
+        }
+        //     ù word start  bit
+        else if (i == WHEEL_SIZE / 64) {
+            bits &= ((uint64_t)1 << (start % 64)) - 1;
+        }
+
+        if (bits) {
+            return word * 64 + __builtin_ctzll(bits);
+        }
+    }
+
+    return -1;
+}
+
+//    overflow event slot ̵
+void wheel_migrate(Event_Queue* q) {
+    while (q->heap_count > 0 && (int)(q->heap[0].key >> 32) - q->wheel_now < WHEEL_SIZE) {
+        wheel_append(q, event_heap_pop(q));
+    }
+}
+
+void wheel_push(Event_Queue* q, Event_Node e) {
+    if ((int)(e.key >> 32) - q->wheel_now < WHEEL_SIZE) {
+        wheel_append(q, e);
+    }
+    else {
+        event_heap_push(q, e);
+    }
+}
+
+Event_Node wheel_pop(Event_Queue* q) {
+    // slot   overflow  ̸  ̵
+    if (q->wheel_count == 0) {
+        q->wheel_now = (int)(q->heap[0].key >> 32);
+        wheel_migrate(q);
+    }
+
+    int start = q->wheel_now & WHEEL_MASK;
+    int slot = wheel_find_slot(q, start);
+    int time = q->wheel_now + ((slot - start) & WHEEL_MASK);
+
+    if (time != q->wheel_now) {
+        q->wheel_now = time;
+        wheel_migrate(q);
+    }
+
+    int index = q->head[slot];
+    Event_Node e = q->pool[index].e;
+
+    q->head[slot] = q->pool[index].next;
+
+    if (q->head[slot] < 0) {
+        q->bitmap[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+    }
+
+    q->pool[index].next = q->free_node;
+    q->free_node = index;
+    q->wheel_count--;
+
+    return e;
+}
+
+int wheel_next_time(Event_Queue* q) {
+    if (q->wheel_count == 0) {
+        return (int)(q->heap[0].key >> 32);
+    }
+
+    int start = q->wheel_now & WHEEL_MASK;
+
+    return q->wheel_now + ((wheel_find_slot(q, start) - start) & WHEEL_MASK);
+}
+
+// slot list overflow ҵ event ,  event  ȯ
+int wheel_purge(Event_Queue* q, const uint32_t* generation) {
+    int removed = 0;
+
+    for (int word = 0; word < WHEEL_SIZE / 64; word++) {
+        uint64_t bits = q->bitmap[word];
+
+        while (bits) {
+            int slot = word * 64 + __builtin_ctzll(bits);
+            int index = q->head[slot];
+            int* link = &q->head[slot];
+
+            bits &= bits - 1;
+            q->tail[slot] = -1;
+
+            while (index >= 0) {
+                int next = q->pool[index].next;
+
+                if (event_node_live(q->pool[index].e, generation)) {
+                    *link = index;
+                    link = &q->pool[index].next;
+                    q->tail[slot] = index;
                 }
-                //   process
                 else {
-                    p->completion_time = now;
-                    completed_process_count++;
+                    q->pool[index].next = q->free_node;
+                    q->free_node = index;
+                    removed++;
+                }
+
+                index = next;
+            }
+
+            *link = -1;
+
+            if (q->head[slot] < 0) {
+                q->bitmap[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+            }
+        }
+    }
+
+    q->wheel_count -= removed;
+
+    return removed + event_heap_purge(q, generation);
+}
+
+
+//  ִ · ʱȭ, heap pool buffer arena Ƿ arena_reset Բ 
+void event_queue_reset(Event_Queue* q) {
+    q->count = 0;
+    q->dead = 0;
+    q->seq = 0;
+    q->popped = 0;
+    SIM_STAT(q->expansions = 0);
+    q->heap = NULL;
+    q->heap_capacity = 0;
+    q->heap_count = 0;
+
+    q->pool = NULL;
+    q->pool_capacity = 0;
+    q->pool_used = 0;
+    q->free_node = -1;
+    q->wheel_now = 0;
+    q->wheel_count = 0;
+
+    for (int i = 0; i < WHEEL_SIZE; i++) {
+        q->head[i] = -1;
+        q->tail[i] = -1;
+    }
+
+    for (int i = 0; i < WHEEL_SIZE / 64; i++) {
+        q->bitmap[i] = 0;
+    }
+}
+
+void event_queue_init(Event_Queue* q, Event_Queue_Type type, Arena* arena) {
+    q->type = type;
+    q->arena = arena;
+
+    event_queue_reset(q);
+}
+
+int event_node_compare(const void* a, const void* b) {
+    uint64_t x = (*(Event_Node* const*)a)->key;
+    uint64_t y = (*(Event_Node* const*)b)->key;
+
+    return (x > y) - (x < y);
+}
+
+//  event push  0 ٽ Űܼ seq 32bit  ʵ  (event  )
+void event_queue_renumber(Event_Queue* q) {
+    Event_Node** node = xmalloc(sizeof(Event_Node*) * (q->count > 0 ? q->count : 1));
+    int n = 0;
+
+    if (!node) {
+        fprintf(stderr, "event queue: out of memory (%d events)\n", q->count);
+        exit(1);
+    }
+
+    for (int i = 0; i < q->heap_count; i++) {
+        node[n++] = &q->heap[i];
+    }
+
+    if (q->type == EVENT_QUEUE_WHEEL) {
+        for (int slot = 0; slot < WHEEL_SIZE; slot++) {
+            for (int index = q->head[slot]; index >= 0; index = q->pool[index].next) {
+                node[n++] = &q->pool[index].e;
+            }
+        }
+    }
+
+    qsort(node, n, sizeof(Event_Node*), event_node_compare);
+
+    for (int i = 0; i < n; i++) {
+        node[i]->key = (node[i]->key & ~(uint64_t)UINT32_MAX) | (uint32_t)i;
+    }
+
+    q->seq = (uint32_t)n;
+    free(node);
+}
+
+// index° process event time  ߰
+void event_queue_push(Event_Queue* q, int time, uint32_t type, uint32_t index) {
+    Event_Node e;
+
+    if (q->seq == UINT32_MAX) {
+        event_queue_renumber(q);
+    }
+
+    e.key = ((uint64_t)(uint32_t)time << 32) | q->seq++;
+    e.index = index;
+    e.type = type;
+
+    if (q->type == EVENT_QUEUE_WHEEL) {
+        wheel_push(q, e);
+    }
+    else {
+        event_heap_push(q, e);
+    }
+
+    q->count++;
+}
+
+Event_Node event_queue_pop(Event_Queue* q) {
+    q->count--;
+    q->popped++;
+
+    if (q->type == EVENT_QUEUE_WHEEL) {
+        return wheel_pop(q);
+    }
+
+    return event_heap_pop(q);
+}
+
+//   ߻ event 
+int event_queue_next_time(Event_Queue* q) {
+    if (q->type == EVENT_QUEUE_WHEEL) {
+        return wheel_next_time(q);
+    }
+
+    return (int)(q->heap[0].key >> 32);
+}
+
+// ҵ event   (process generation ٸ event),  event  ȯ
+int event_queue_purge(Event_Queue* q, const uint32_t* generation) {
+    int removed;
+
+    if (q->type == EVENT_QUEUE_WHEEL) {
+        removed = wheel_purge(q, generation);
+    }
+    else {
+        removed = event_heap_purge(q, generation);
+    }
+
+    q->count -= removed;
+    q->dead -= removed;
+
+    return removed;
+}
+
+
+// xoshiro256**   (Blackman, Vigna)
+// seed ϸ  workload ǰ, jump  ġ ʴ stream   
+typedef struct {
+    uint64_t s[4];
+} Rng;
+
+uint64_t splitmix64(uint64_t* x) {
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+//  ü 0  ʵ splitmix64 seed ħ
+void rng_seed(Rng* r, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        r->s[i] = splitmix64(&seed);
+    }
+}
+
+uint64_t rng_next(Rng* r) {
+    uint64_t* s = r->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+
+    return result;
+}
+
+// 2^128 rng_next ȣ Ͱ  · ̵ (workload  stream)
+void rng_jump(Rng* r) {
+    const uint64_t jump[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+    uint64_t s[4] = { 0, 0, 0, 0 };
+
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & ((uint64_t)1 << b)) {
+                for (int k = 0; k < 4; k++) {
+                    s[k] ^= r->s[k];
                 }
+            }
+
+            rng_next(r);
+        }
+    }
+
+    for (int k = 0; k < 4; k++) {
+        r->s[k] = s[k];
+    }
+}
+
+// [0, 1) յ 
+double rng_uniform(Rng* r) {
+    return (double)(rng_next(r) >> 11) * 0x1.0p-53;
+}
+
+// [low, high]  յ  (  ̹Ƿ  ,  2^-32 )
+int rng_range(Rng* r, int low, int high) {
+    uint64_t range = (uint64_t)(high - low) + 1;
+    return low + (int)(((rng_next(r) >> 32) * range) >> 32);
+}
+
+//  mean  
+double rng_exponential(Rng* r, double mean) {
+    return -mean * log1p(-rng_uniform(r));
+}
+
+// ǥ   (Box-Muller)
+double rng_normal(Rng* r) {
+    double u = 1.0 - rng_uniform(r); // (0, 1]
+    double v = rng_uniform(r);
+
+    return sqrt(-2.0 * log(u)) * cos(2.0 * 3.14159265358979323846 * v);
+}
+
+// ߾Ӱ median log-normal 
+double rng_lognormal(Rng* r, double median, double sigma) {
+    return median * exp(sigma * rng_normal(r));
+}
+
+// ּڰ scale Pareto  (alpha   β)
+double rng_pareto(Rng* r, double scale, double alpha) {
+    return scale / pow(1.0 - rng_uniform(r), 1.0 / alpha);
+}
+
+
+typedef enum {
+    ARRIVAL_UNIFORM, // 0 ~ 9
+    ARRIVAL_EXPONENTIAL, //  arrival_mean     (Poisson )
+} Arrival_Distribution;
+
+typedef enum {
+    BURST_UNIFORM, // cpu 2 ~ 10, io 1 ~ 5
+    BURST_LOGNORMAL,
+    BURST_PARETO, // Ҽ ſ  burst
+    BURST_BIMODAL, // cpu-bound io-bound process ȥ
+} Burst_Distribution;
+
+// binary workload : header ڿ process record ƴ ̾ (little-endian)
+// record Process պκа  ̹Ƿ mmap ״ о 
+#define WORKLOAD_MAGIC "SCHEDWL1"
+
+typedef struct {
+    char magic[8];
+    uint32_t record_size; // sizeof(Workload_Record)
+    uint32_t reserved;
+    uint64_t process_count;
+} Workload_Header;
+
+typedef struct {
+    int32_t pid;
+    int32_t priority;
+    int32_t arrival_time;
+    int32_t cpu_burst;
+    int32_t io_burst;
+    int32_t io_request_time;
+} Workload_Record;
+
+//  workload ũ 
+typedef struct {
+    int process_count;
+    const Workload_Record* records; // NULL ƴϸ    record  (workload )
+    Arrival_Distribution arrival;
+    double arrival_mean;
+    Burst_Distribution burst;
+    double cpu_bound_ratio; // BURST_BIMODAL cpu-bound process 
+} Workload_Spec;
+
+#define MAX_BURST 10000 //    burst 
+
+int clamp_burst(double value, int min) {
+    if (value < min) {
+        return min;
+    }
+    if (value > MAX_BURST) {
+        return MAX_BURST;
+    }
+    return (int)(value + 0.5);
+}
+
+
+// mmap workload 
+typedef struct {
+    const Workload_Record* records;
+    int process_count;
+    void* base;
+    size_t size;
+} Workload_File;
+
+// record simulation  ϴ Ȯ (io request cpu burst  1)
+// pid  (gantt chart 0 Idle),   burst  ϴ workload   
+bool workload_record_valid(const Workload_Record* r) {
+    return r->pid > 0 && r->arrival_time >= 0 && r->cpu_burst >= 2 && r->io_burst >= 1 && r->io_request_time >= 1 &&
+        r->io_request_time < r->cpu_burst && (int64_t)r->arrival_time + r->cpu_burst + r->io_burst <= (int64_t)MAX_ARRIVAL_TIME + 2 * MAX_BURST;
+}
+
+int compare_pid(const void* a, const void* b) {
+    int32_t x = *(const int32_t*)a;
+    int32_t y = *(const int32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+// pid 迭 ؼ   ̻  pid ã ( 0)
+int32_t find_duplicate_pid(int32_t* pid, int count) {
+    qsort(pid, count, sizeof(int32_t), compare_pid);
+
+    for (int i = 1; i < count; i++) {
+        if (pid[i] == pid[i - 1]) {
+            return pid[i];
+        }
+    }
+
+    return 0;
+}
+
+void workload_close(Workload_File* f) {
+#ifdef _WIN32
+    free(f->base);
+#else
+    if (f->base) {
+        munmap(f->base, f->size);
+    }
+#endif
+    f->base = NULL;
+}
+
+bool workload_open(Workload_File* f, const char* path) {
+    f->base = NULL;
+    f->size = 0;
+
+#ifdef _WIN32
+    // mmap   ü 
+    FILE* file = fopen(path, "rb");
+
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    f->base = size > 0 ? xmalloc(size) : NULL;
+
+    if (!f->base || fread(f->base, 1, size, file) != (size_t)size) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        fclose(file);
+        free(f->base);
+        return false;
+    }
+
+    f->size = size;
+    fclose(file);
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+
+    f->size = st.st_size;
+    f->base = f->size > 0 ? mmap(NULL, f->size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+
+    if (f->base == MAP_FAILED) {
+        fprintf(stderr, "%s: cannot map\n", path);
+        f->base = NULL;
+        return false;
+    }
+
+    // ó    Ƿ ̸ б
+    madvise(f->base, f->size, MADV_SEQUENTIAL);
+#endif
+
+    const Workload_Header* header = f->base;
+
+    if (f->size < sizeof(Workload_Header) || memcmp(header->magic, WORKLOAD_MAGIC, 8) != 0 || header->record_size != sizeof(Workload_Record)) {
+        fprintf(stderr, "%s: not a workload file\n", path);
+        workload_close(f);
+        return false;
+    }
+
+    if (header->process_count == 0 || header->process_count > INT32_MAX ||
+        header->process_count > (f->size - sizeof(Workload_Header)) / sizeof(Workload_Record)) {
+        fprintf(stderr, "%s: bad process count %llu\n", path, (unsigned long long)header->process_count);
+        workload_close(f);
+        return false;
+    }
+
+    f->records = (const Workload_Record*)(header + 1);
+    f->process_count = (int)header->process_count;
+
+    return true;
+}
+
+//  record ǰ ġ pid ˻ (--verify),   false
+// --import-csv --export-workload     ˻Ƿ workload_open header ũ⸸ Ȯ
+bool workload_verify(const Workload_File* f, const char* path) {
+    for (int i = 0; i < f->process_count; i++) {
+        if (!workload_record_valid(&f->records[i])) {
+            fprintf(stderr, "%s: invalid process record %d\n", path, i);
+            return false;
+        }
+    }
+
+    // --dump gantt chart pid process ϹǷ ġ  
+    int32_t* pid = xmalloc(sizeof(int32_t) * f->process_count);
+
+    if (!pid) {
+        fprintf(stderr, "%s: out of memory (%d processes)\n", path, f->process_count);
+        return false;
+    }
+
+    for (int i = 0; i < f->process_count; i++) {
+        pid[i] = f->records[i].pid;
+    }
+
+    int32_t duplicate = find_duplicate_pid(pid, f->process_count);
+    free(pid);
+
+    if (duplicate) {
+        fprintf(stderr, "%s: duplicate pid %d\n", path, duplicate);
+        return false;
+    }
+
+    return true;
+}
+
+// ڿ  ϳ а (ǥ, ) ǳʶ, ϸ false
+bool csv_field(const char** cursor, int32_t* value) {
+    const char* s = *cursor;
+    char* end;
+
+    while (*s == ' ' || *s == '\t') {
+        s++;
+    }
+
+    long v = strtol(s, &end, 10);
+
+    if (end == s || v < INT32_MIN || v > INT32_MAX) {
+        return false;
+    }
+
+    while (*end == ' ' || *end == '\t' || *end == ',') {
+        end++;
+    }
+
+    *value = (int32_t)v;
+    *cursor = end;
+
+    return true;
+}
+
+// CSV (PID,Priority,Arrival,CPU_Burst,IO_Request,IO_Burst , print_process_list )
+//  پ о binary workload Ϸ ȯ, ȯ process  ȯ (ϸ -1)
+// ڷ  ʴ (header, ּ)   ǳʶ
+long long import_csv(const char* csv_path, const char* workload_path) {
+    FILE* in = fopen(csv_path, "r");
+
+    if (!in) {
+        fprintf(stderr, "%s: cannot open\n", csv_path);
+        return -1;
+    }
+
+    FILE* out = fopen(workload_path, "wb");
+
+    if (!out) {
+        fprintf(stderr, "%s: cannot create\n", workload_path);
+        fclose(in);
+        return -1;
+    }
+
+    // process   ä
+    Workload_Header header;
+    memcpy(header.magic, WORKLOAD_MAGIC, 8);
+    header.record_size = sizeof(Workload_Record);
+    header.reserved = 0;
+    header.process_count = 0;
+    fwrite(&header, sizeof(header), 1, out);
+
+    Workload_Record buffer[4096];
+    int buffered = 0;
+    long long line_number = 0;
+    char line[1024];
+    bool ok = true;
+
+    // ġ pid ˻
+    int32_t* pid = NULL;
+    int pid_count = 0;
+    int pid_capacity = 0;
+
+    while (fgets(line, sizeof(line), in)) {
+        const char* cursor = line;
+        line_number++;
+
+        while (*cursor == ' ' || *cursor == '\t') {
+            cursor++;
+        }
+
+        if (!(*cursor >= '0' && *cursor <= '9') && *cursor != '-') {
+            continue;
+        }
+
+        Workload_Record* r = &buffer[buffered];
+
+        if (!csv_field(&cursor, &r->pid) || !csv_field(&cursor, &r->priority) || !csv_field(&cursor, &r->arrival_time) ||
+            !csv_field(&cursor, &r->cpu_burst) || !csv_field(&cursor, &r->io_request_time) || !csv_field(&cursor, &r->io_burst) ||
+            !workload_record_valid(r)) {
+            fprintf(stderr, "%s:%lld: invalid process record\n", csv_path, line_number);
+            ok = false;
+            break;
+        }
+
+        if (pid_count == pid_capacity) {
+            int new_capacity = pid_capacity ? pid_capacity * 2 : 4096;
+            int32_t* new_pid = xrealloc(pid, sizeof(int32_t) * new_capacity);
+
+            if (!new_pid) {
+                fprintf(stderr, "%s: out of memory (%d processes)\n", csv_path, pid_count);
+                ok = false;
+                break;
+            }
+
+            pid = new_pid;
+            pid_capacity = new_capacity;
+        }
+
+        pid[pid_count++] = r->pid;
+
+        if (++buffered == 4096) {
+            fwrite(buffer, sizeof(Workload_Record), buffered, out);
+            header.process_count += buffered;
+            buffered = 0;
+        }
+    }
+
+    fwrite(buffer, sizeof(Workload_Record), buffered, out);
+    header.process_count += buffered;
+
+    if (ok && header.process_count == 0) {
+        fprintf(stderr, "%s: no process records\n", csv_path);
+        ok = false;
+    }
+
+    if (ok) {
+        int32_t duplicate = find_duplicate_pid(pid, pid_count);
+
+        if (duplicate) {
+            fprintf(stderr, "%s: duplicate pid %d\n", csv_path, duplicate);
+            ok = false;
+        }
+    }
+
+    free(pid);
+
+    if (ok) {
+        fseek(out, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, out);
+    }
+
+    if (ferror(out)) {
+        fprintf(stderr, "%s: write error\n", workload_path);
+        ok = false;
+    }
+
+    fclose(in);
+    fclose(out);
+
+    if (!ok) {
+        remove(workload_path);
+    }
+
+    return ok ? (long long)header.process_count : -1;
+}
+
+// workload  record ϳ process 
+void copy_record(Process* p, const Workload_Record* r) {
+    p->pid = r->pid;
+    p->priority = r->priority;
+    p->arrival_time = r->arrival_time;
+    p->cpu_burst = r->cpu_burst;
+    p->io_burst = r->io_burst;
+    p->io_request_time = r->io_request_time;
+}
+
+// spec  process ϳ 
+// clock ARRIVAL_EXPONENTIAL  process   (  )
+void generate_process(Process* p, int pid, Rng* rng, const Workload_Spec* spec, double* clock) {
+    p->pid = pid;
+    p->priority = rng_range(rng, 1, 5); // 1 ~ 5
+
+    if (spec->arrival == ARRIVAL_EXPONENTIAL) {
+        *clock += rng_exponential(rng, spec->arrival_mean);
+
+        //    int   ʵ ѿ  (open system horizon ̹Ƿ  )
+        if (*clock > MAX_ARRIVAL_TIME) {
+            *clock = MAX_ARRIVAL_TIME;
+        }
+
+        p->arrival_time = (int)*clock;
+    }
+    else {
+        p->arrival_time = rng_range(rng, 0, 9); // 0 ~ 9
+    }
+
+    // cpu burst ּ 2 (io request cpu burst ߿ ߻ؾ ), io burst ּ 1
+    if (spec->burst == BURST_LOGNORMAL) {
+        p->cpu_burst = clamp_burst(rng_lognormal(rng, 5.0, 0.75), 2);
+        p->io_burst = clamp_burst(rng_lognormal(rng, 3.0, 0.5), 1);
+    }
+    else if (spec->burst == BURST_PARETO) {
+        p->cpu_burst = clamp_burst(rng_pareto(rng, 2.0, 1.5), 2);
+        p->io_burst = clamp_burst(rng_pareto(rng, 1.0, 2.0), 1);
+    }
+    // cpu-bound:  cpu burst, ª io / io-bound: ª cpu burst,  io
+    else if (spec->burst == BURST_BIMODAL) {
+        if (rng_uniform(rng) < spec->cpu_bound_ratio) {
+            p->cpu_burst = rng_range(rng, 10, 30);
+            p->io_burst = rng_range(rng, 1, 2);
+        }
+        else {
+            p->cpu_burst = rng_range(rng, 2, 4);
+            p->io_burst = rng_range(rng, 5, 15);
+        }
+    }
+    else {
+        p->cpu_burst = rng_range(rng, 2, 10); // 2 ~ 10
+        p->io_burst = rng_range(rng, 1, 5); // 1 ~ 5
+    }
+
+    p->io_request_time = rng_range(rng, 1, p->cpu_burst - 1); // 1 ~ (cpu_burst - 1), cpu burst  1 
+}
+
+
+// spec  seed  workload binary workload Ϸ ,  process  ȯ (ϸ -1)
+// create_process   ϹǷ -f   -n, -s  workload  (main2  workload   )
+// pid 1 ʷ ̰ generate_process record workload_record_valid ׻ ϹǷ  ˻ 
+long long export_workload(const Workload_Spec* spec, uint64_t seed, const char* workload_path) {
+    FILE* out = fopen(workload_path, "wb");
+
+    if (!out) {
+        fprintf(stderr, "%s: cannot create\n", workload_path);
+        return -1;
+    }
+
+    Workload_Header header;
+    memcpy(header.magic, WORKLOAD_MAGIC, 8);
+    header.record_size = sizeof(Workload_Record);
+    header.reserved = 0;
+    header.process_count = spec->process_count;
+    fwrite(&header, sizeof(header), 1, out);
+
+    Rng rng;
+    rng_seed(&rng, seed);
+
+    Workload_Record buffer[4096];
+    int buffered = 0;
+    double clock = 0;
+
+    for (int i = 0; i < spec->process_count; i++) {
+        Process p;
+        Workload_Record* r = &buffer[buffered];
+
+        generate_process(&p, i + 1, &rng, spec, &clock);
+
+        r->pid = p.pid;
+        r->priority = p.priority;
+        r->arrival_time = p.arrival_time;
+        r->cpu_burst = p.cpu_burst;
+        r->io_burst = p.io_burst;
+        r->io_request_time = p.io_request_time;
+
+        if (++buffered == 4096) {
+            fwrite(buffer, sizeof(Workload_Record), buffered, out);
+            buffered = 0;
+        }
+    }
+
+    fwrite(buffer, sizeof(Workload_Record), buffered, out);
+
+    bool ok = !ferror(out);
+
+    if (fclose(out) != 0) {
+        ok = false;
+    }
+
+    if (!ok) {
+        fprintf(stderr, "%s: write error\n", workload_path);
+        remove(workload_path);
+        return -1;
+    }
+
+    return spec->process_count;
+}
+
+
+// gantt chart process      (ϵ  ð Idle)
+typedef struct {
+    int start; //   
+    int end; //    (end  )
+    int pid;
+    bool io; //    I/O request ߻
+} Gantt_Interval;
+
+typedef struct {
+    Gantt_Interval* interval;
+    Arena* arena;
+    int count;
+    int capacity;
+    int end;
+    bool record; // false   (open system)
+} Gantt_Chart;
+
+// [start, end)  pid   ,   ̾ ħ
+void gantt_record(Gantt_Chart* g, int start, int end, int pid) {
+    if (start >= end || pid == 0 || !g->record) {
+        return;
+    }
+
+    if (g->count > 0) {
+        Gantt_Interval* last = &g->interval[g->count - 1];
+
+        if (last->pid == pid && last->end == start && !last->io) {
+            last->end = end;
+            return;
+        }
+    }
+
+    if (g->count == g->capacity) {
+        int new_capacity = g->capacity ? g->capacity * 2 : 64;
+        Gantt_Interval* new_interval = arena_alloc(g->arena, sizeof(Gantt_Interval) * new_capacity);
+
+        if (g->count > 0) {
+            memcpy(new_interval, g->interval, sizeof(Gantt_Interval) * g->count);
+        }
+
+        g->interval = new_interval;
+        g->capacity = new_capacity;
+    }
+
+    g->interval[g->count].start = start;
+    g->interval[g->count].end = end;
+    g->interval[g->count].pid = pid;
+    g->interval[g->count].io = false;
+    g->count++;
+}
+
+// time   pid  I/O request ǥ
+void gantt_mark_io(Gantt_Chart* g, int time, int pid) {
+    if (g->count > 0 && g->interval[g->count - 1].end == time && g->interval[g->count - 1].pid == pid) {
+        g->interval[g->count - 1].io = true;
+    }
+}
+
+
+// , л   ȸ ϴ   (Welford)
+typedef struct {
+    long long count;
+    double mean;
+    double m2; // հ  
+    double min;
+    double max;
+} Running_Stat;
+
+void running_stat_init(Running_Stat* s) {
+    s->count = 0;
+    s->mean = 0;
+    s->m2 = 0;
+    s->min = 0;
+    s->max = 0;
+}
+
+void running_stat_add(Running_Stat* s, double x) {
+    s->count++;
+
+    double delta = x - s->mean;
+    s->mean += delta / s->count;
+    s->m2 += delta * (x - s->mean);
+
+    if (s->count == 1 || x < s->min) {
+        s->min = x;
+    }
+    if (s->count == 1 || x > s->max) {
+        s->max = x;
+    }
+}
+
+double running_stat_stddev(const Running_Stat* s) {
+    return s->count > 1 ? sqrt(s->m2 / (s->count - 1)) : 0;
+}
+
+#define HISTOGRAM_SUB_BITS 7
+#define HISTOGRAM_SUB_COUNT (1 << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_HALF (HISTOGRAM_SUB_COUNT / 2)
+#define HISTOGRAM_BUCKETS ((32 - HISTOGRAM_SUB_BITS) * HISTOGRAM_HALF + HISTOGRAM_HALF)
+
+// 0 ̻ int   (HDR histogram)
+// HISTOGRAM_SUB_COUNT ̸  bucket ϳ,  ̻ 2 ŵ  HISTOGRAM_HALF Ƿ   1/64 
+// ũⰡ Ǿ ְ bucket ϸ Ƿ workload, thread histogram merge  
+typedef struct {
+    uint64_t bucket[HISTOGRAM_BUCKETS];
+    uint64_t count;
+    int max;
+} Histogram;
+
+void histogram_init(Histogram* h) {
+    memset(h, 0, sizeof(Histogram));
+}
+
+int histogram_index(int value) {
+    if (value < HISTOGRAM_SUB_COUNT) {
+        return value;
+    }
+
+    int shift = 31 - __builtin_clz((unsigned)value) - HISTOGRAM_SUB_BITS + 1;
+
+    return shift * HISTOGRAM_HALF + (value >> shift);
+}
+
+// index° bucket   ū 
+long long histogram_value(int index) {
+    if (index < HISTOGRAM_SUB_COUNT) {
+        return index;
+    }
+
+    int shift = index / HISTOGRAM_HALF - 1;
+    long long sub = index - shift * HISTOGRAM_HALF;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+void histogram_add(Histogram* h, int value) {
+    if (value < 0) {
+        value = 0;
+    }
+
+    h->bucket[histogram_index(value)]++;
+    h->count++;
+
+    if (value > h->max) {
+        h->max = value;
+    }
+}
+
+void histogram_merge(Histogram* dst, const Histogram* src) {
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        dst->bucket[i] += src->bucket[i];
+    }
+
+    dst->count += src->count;
+
+    if (src->max > dst->max) {
+        dst->max = src->max;
+    }
+}
+
+//  q (0 < q <= 1) ġ , bucket  ū  ϵ ִ  
+int histogram_percentile(const Histogram* h, double q) {
+    if (h->count == 0) {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)ceil(q * h->count);
+    uint64_t seen = 0;
+
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += h->bucket[i];
+
+        if (seen >= rank) {
+            long long value = histogram_value(i);
+            return value < h->max ? (int)value : h->max;
+        }
+    }
+
+    return h->max;
+}
+
+// process Ϸ  ϴ waiting, turnaround, response time 
+typedef struct {
+    Histogram waiting;
+    Histogram turnaround;
+    Histogram response;
+} Latency_Distribution;
+
+void latency_init(Latency_Distribution* l) {
+    histogram_init(&l->waiting);
+    histogram_init(&l->turnaround);
+    histogram_init(&l->response);
+}
+
+void latency_merge(Latency_Distribution* dst, const Latency_Distribution* src) {
+    histogram_merge(&dst->waiting, &src->waiting);
+    histogram_merge(&dst->turnaround, &src->turnaround);
+    histogram_merge(&dst->response, &src->response);
+}
+
+// metric 0: waiting, 1: turnaround, 2: response
+const Histogram* latency_metric(const Latency_Distribution* l, int metric) {
+    if (metric == 0) {
+        return &l->waiting;
+    }
+    else if (metric == 1) {
+        return &l->turnaround;
+    }
+
+    return &l->response;
+}
+
+// event loop ٷ ϴ run ü ǥ (gantt chart  ʾƵ )
+// open system warm-up   warm-up   process ݿ
+typedef struct {
+    long long busy_time; // process CPU  ð
+    long long response_sum; //  ó CPU Ҵ  ð 
+    long long responded; // response_sum ݿ process 
+    long long completed; // Ϸ process 
+    long long dispatches; // ready process  CPU Ҵ Ƚ
+    int end_time; //  ó event 
+} Run_Metrics;
+
+// open system: process  ϰ,  process ڸ  process 
+//  event ׻ ϳ صΰ,    process 
+typedef struct {
+    bool enabled;
+    int horizon; //    event ó 
+    int warmup; //     process 迡 
+
+    const Workload_Spec* spec;
+    Rng rng;
+    double clock; //     (ARRIVAL_EXPONENTIAL)
+    int next_record; // workload Ͽ   record
+    long long arrived;
+
+    //  ִ process ڸ (FIFO,    ڸ )
+    int* free_slot;
+    int free_head;
+    int free_count;
+    int peak_active; // ÿ system ִ ִ process 
+
+    //  ڸ   process ڸ    ̷ (  ״ ιǷ ̷ ð waiting )
+    bool blocked;
+    Process pending;
+    long long deferred; //  ̷ process 
+
+    Running_Stat waiting;
+    Running_Stat turnaround;
+    Running_Stat response;
+} Open_System;
+
+// open system  
+typedef struct {
+    int horizon;
+    int warmup;
+    int pool_size; // ÿ system   ִ ִ process 
+} Open_Options;
+
+
+// simulation ϳ ϴ  
+//    context  ϹǷ  simulation ÿ   
+typedef struct {
+    Process* process_list;
+    int process_count;
+    Process_Table table;
+
+    Process_Queue ready_queue; // FCFS, Round Robin
+    Process_Heap ready_heap; // SJF, Priority
+    Waiting_Queue waiting_queue;
+    Event_Queue events;
+    uint32_t* generation; // process generation, preemption   pending CPU complete event 
+    Gantt_Chart gantt;
+
+    //  queue, heap, event queue, gantt chart open system  ڸ  ϴ memory
+    // initialization resetϹǷ run ̿ , Ҵ 
+    Arena arena;
+
+    Latency_Distribution* latency; // Ϸ process    (NULL̸  )
+    Run_Metrics metrics;
+#ifdef SIM_STATS
+    Sim_Stats stats;
+#endif
+
+    int time_quantum; // Round Robin
+    int context_switch; // Round Robin ٸ process ü   ð
+
+    Open_System open;
+} SimContext;
+
+void sim_init(SimContext* ctx, int process_count, Event_Queue_Type event_queue_type) {
+    size_t bytes = sizeof(int) * process_count;
+
+    ctx->process_count = process_count;
+    ctx->process_list = xmalloc(sizeof(Process) * process_count);
+
+    ctx->table.arrival_time = xmalloc(bytes);
+    ctx->table.service_time = xmalloc(bytes);
+    ctx->table.start_time = xmalloc(bytes);
+    ctx->table.completion_time = xmalloc(bytes);
+    ctx->table.waiting_time = xmalloc(bytes);
+    ctx->table.turnaround_time = xmalloc(bytes);
+    ctx->generation = xcalloc(process_count, sizeof(uint32_t));
+
+    if (!ctx->process_list || !ctx->table.arrival_time || !ctx->table.service_time || !ctx->table.start_time ||
+        !ctx->table.completion_time || !ctx->table.waiting_time || !ctx->table.turnaround_time || !ctx->generation) {
+        fprintf(stderr, "simulation: out of memory (%d processes)\n", process_count);
+        exit(1);
+    }
+
+    // queue buffer initialization arenaκ Ҵ
+    arena_init(&ctx->arena, ARENA_INITIAL_SIZE);
+    ctx->ready_queue.process = NULL;
+    ctx->ready_heap.node = NULL;
+    waiting_init(&ctx->waiting_queue);
+    event_queue_init(&ctx->events, event_queue_type, &ctx->arena);
+
+    ctx->gantt.interval = NULL;
+    ctx->gantt.arena = &ctx->arena;
+    ctx->gantt.count = 0;
+    ctx->gantt.capacity = 0;
+    ctx->gantt.end = 0;
+    ctx->gantt.record = true;
+
+    ctx->time_quantum = DEFAULT_TIME_QUANTUM;
+    ctx->context_switch = 0;
+
+    ctx->latency = NULL;
+
+    ctx->open.enabled = false;
+    ctx->open.free_slot = NULL;
+}
+
+void sim_free(SimContext* ctx) {
+    free(ctx->process_list);
+    free(ctx->table.arrival_time);
+    free(ctx->table.service_time);
+    free(ctx->table.start_time);
+    free(ctx->table.completion_time);
+    free(ctx->table.waiting_time);
+    free(ctx->table.turnaround_time);
+    free(ctx->generation);
+    arena_free(&ctx->arena);
+}
+
+int process_index(SimContext* ctx, Process* p) {
+    return (int)(p - ctx->process_list);
+}
+
+void push_event(SimContext* ctx, int time, int type, Process* p) {
+    int index = process_index(ctx, p);
+
+    event_queue_push(&ctx->events, time, (uint32_t)type | ctx->generation[index] << EVENT_TYPE_BITS, (uint32_t)index);
+    SIM_STAT(ctx->stats.events_pushed++);
+}
+
+Event_Heap pop_event(SimContext* ctx) {
+    SIM_STAT(uint64_t start = read_cycles());
+
+    Event_Node top = event_queue_pop(&ctx->events);
+
+    SIM_STAT(ctx->stats.pop_cycles += read_cycles() - start);
+    SIM_STAT(ctx->stats.events_popped++);
+
+    Event_Heap e;
+    e.time = (int)(top.key >> 32);
+    e.type = (int)(top.type & EVENT_TYPE_MASK);
+    e.generation = top.type >> EVENT_TYPE_BITS;
+    e.p = &ctx->process_list[top.index];
+
+    return e;
+}
+
+// push  preemption ҵ  event
+bool event_live(SimContext* ctx, Event_Heap* e) {
+    return e->generation == ctx->generation[process_index(ctx, e->p)];
+}
+
+//  event ҵ event 
+void discard_event(SimContext* ctx) {
+    ctx->events.dead--;
+    SIM_STAT(ctx->stats.stale_events++);
+}
+
+// p pending event 
+// event queue  ó , ҵ event EVENT_PURGE_MIN ̻̰   queue 
+void cancel_event(SimContext* ctx, Process* p) {
+    int index = process_index(ctx, p);
+
+    ctx->generation[index] = (ctx->generation[index] + 1) & EVENT_GENERATION_MASK;
+    ctx->events.dead++;
+
+    if (ctx->events.dead >= EVENT_PURGE_MIN && ctx->events.dead > ctx->events.count / 2) {
+        SIM_STAT(ctx->stats.stale_events += ctx->events.dead);
+        SIM_STAT(ctx->stats.purges++);
+
+        event_queue_purge(&ctx->events, ctx->generation);
+    }
+}
+
+int next_event_time(SimContext* ctx) {
+    return event_queue_next_time(&ctx->events);
+}
+
+// time   event e , ҵ event   false
+bool pop_event_at(SimContext* ctx, int time, Event_Heap* e) {
+    while (ctx->events.count > 0 && next_event_time(ctx) == time) {
+        *e = pop_event(ctx);
+
+        if (event_live(ctx, e)) {
+            return true;
+        }
+
+        discard_event(ctx);
+    }
+
+    return false;
+}
+
+//  process   ʱȭ
+void reset_process(Process* p) {
+    p->remaining_cpu = p->cpu_burst;
+    p->remaining_io = 0;
+    p->executed_time = 0;
+    p->heap_index = -1;
+    p->wait_prev = NULL;
+    p->wait_next = NULL;
+    p->waiting = false;
+}
+
+//  scheduling   ʱȭ (ӵ 迭̹Ƿ memset, vector store ó)
+void reset_metrics(SimContext* ctx) {
+    int* restrict start_time = ctx->table.start_time;
+    size_t bytes = sizeof(int) * ctx->process_count;
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        start_time[i] = -1;
+    }
+
+    memset(ctx->table.completion_time, 0, bytes);
+    memset(ctx->table.waiting_time, 0, bytes);
+    memset(ctx->table.turnaround_time, 0, bytes);
+    memset(&ctx->metrics, 0, sizeof(Run_Metrics));
+}
+
+// completion timeκ turnaround time, waiting time 
+void finalize_metrics(SimContext* ctx) {
+    // open system Ϸ  迡 ݿ
+    if (ctx->open.enabled) {
+        return;
+    }
+
+    const int* restrict arrival_time = ctx->table.arrival_time;
+    const int* restrict service_time = ctx->table.service_time;
+    const int* restrict completion_time = ctx->table.completion_time;
+    int* restrict waiting_time = ctx->table.waiting_time;
+    int* restrict turnaround_time = ctx->table.turnaround_time;
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        turnaround_time[i] = completion_time[i] - arrival_time[i];
+        waiting_time[i] = turnaround_time[i] - service_time[i];
+    }
+}
+
+// open system ȯ, process_count ڸ ϸ rng stream Ǵ workload Ͽ process Ŵ
+//   ʵ gantt chart  
+//  ڸ  arena Ƿ initialization Ŀ ȣ
+void sim_open(SimContext* ctx, const Workload_Spec* spec, const Rng* rng, int horizon, int warmup) {
+    Open_System* o = &ctx->open;
+
+    o->enabled = true;
+    o->horizon = horizon;
+    o->warmup = warmup;
+    o->spec = spec;
+    o->rng = *rng;
+    o->clock = 0;
+    o->next_record = 0;
+    o->arrived = 0;
+
+    o->free_slot = arena_alloc(&ctx->arena, sizeof(int) * ctx->process_count);
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        o->free_slot[i] = i;
+    }
+
+    o->free_head = 0;
+    o->free_count = ctx->process_count;
+    o->peak_active = 0;
+    o->blocked = false;
+    o->deferred = 0;
+
+    running_stat_init(&o->waiting);
+    running_stat_init(&o->turnaround);
+    running_stat_init(&o->response);
+
+    ctx->gantt.record = false;
+}
+
+// next  ڸ ְ  event  (now  ߾ ϴ process now )
+void open_admit(SimContext* ctx, const Process* next, int now) {
+    Open_System* o = &ctx->open;
+    int slot = o->free_slot[o->free_head];
+    o->free_head = (o->free_head + 1) % ctx->process_count;
+    o->free_count--;
+
+    if (ctx->process_count - o->free_count > o->peak_active) {
+        o->peak_active = ctx->process_count - o->free_count;
+    }
+
+    Process* p = &ctx->process_list[slot];
+    *p = *next;
+    o->arrived++;
+
+    ctx->table.arrival_time[slot] = p->arrival_time;
+    ctx->table.service_time[slot] = p->cpu_burst + p->io_burst;
+    ctx->table.start_time[slot] = -1;
+
+    push_event(ctx, p->arrival_time > now ? p->arrival_time : now, 1, p);
+}
+
+//  process   event  (horizon İų    )
+//  ڸ  sim_complete ڸ   ̷
+void open_next_arrival(SimContext* ctx, int now) {
+    Open_System* o = &ctx->open;
+    const Workload_Spec* spec = o->spec;
+    Process next;
+
+    if (spec->records) {
+        if (o->next_record == spec->process_count) {
+            return;
+        }
+
+        copy_record(&next, &spec->records[o->next_record++]);
+    }
+    else {
+        generate_process(&next, (int)(o->arrived % INT32_MAX) + 1, &o->rng, spec, &o->clock);
+    }
+
+    if (next.arrival_time > o->horizon) {
+        return;
+    }
+
+    if (o->free_count == 0) {
+        o->pending = next;
+        o->blocked = true;
+        o->deferred++;
+        return;
+    }
+
+    open_admit(ctx, &next, now);
+}
+
+//  event  (closed:  process, open: ù process)
+void sim_start(SimContext* ctx) {
+    if (ctx->open.enabled) {
+        open_next_arrival(ctx, 0);
+        return;
+    }
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        push_event(ctx, ctx->table.arrival_time[i], 1, &ctx->process_list[i]);
+    }
+}
 
-                executing_process = NULL;
-            }
-            // 3. IO Complete
-            else if (e.type == 3) {
-                p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
+// ó event Ҵ (closed:  process Ϸ , open: horizon )
+bool sim_running(SimContext* ctx, int completed_process_count) {
+    if (ctx->events.count == 0) {
+        return false;
+    }
+
+    if (ctx->open.enabled) {
+        return next_event_time(ctx) <= ctx->open.horizon;
+    }
+
+    return completed_process_count < ctx->process_count;
+}
+
+// now process  ó (open:  process  event )
+void sim_arrive(SimContext* ctx, Process* p, int now) {
+    reset_process(p);
+
+    if (ctx->open.enabled) {
+        open_next_arrival(ctx, now);
+    }
+}
+
+// 踦     (closed: 0, open: warm-up)
+int sim_window_start(SimContext* ctx) {
+    return ctx->open.enabled ? ctx->open.warmup : 0;
+}
+
+// [start, end)  p CPU , gantt chart ϰ busy time 
+void sim_execute(SimContext* ctx, int start, int end, Process* p) {
+    SIM_STAT(uint64_t timeline_start = read_cycles());
+
+    gantt_record(&ctx->gantt, start, end, p->pid);
+
+    SIM_STAT(ctx->stats.timeline_cycles += read_cycles() - timeline_start);
+
+    if (start < sim_window_start(ctx)) {
+        start = sim_window_start(ctx);
+    }
+
+    if (end > start) {
+        ctx->metrics.busy_time += end - start;
+    }
+}
+
+// p time CPU Ҵ, ó Ҵ޴  start time response time 
+void sim_dispatch(SimContext* ctx, Process* p, int time) {
+    int i = process_index(ctx, p);
+
+    if (ctx->table.start_time[i] >= 0) {
+        return;
+    }
+
+    ctx->table.start_time[i] = time;
+
+    if (ctx->table.arrival_time[i] >= sim_window_start(ctx)) {
+        ctx->metrics.response_sum += time - ctx->table.arrival_time[i];
+        ctx->metrics.responded++;
+    }
+}
+
+// Ϸ process ϳ  
+void sim_record_latency(SimContext* ctx, int i, int now) {
+    if (!ctx->latency) {
+        return;
+    }
+
+    int turnaround = now - ctx->table.arrival_time[i];
+
+    histogram_add(&ctx->latency->waiting, turnaround - ctx->table.service_time[i]);
+    histogram_add(&ctx->latency->turnaround, turnaround);
+    histogram_add(&ctx->latency->response, ctx->table.start_time[i] - ctx->table.arrival_time[i]);
+}
+
+// process Ϸ  (open: warm-up   process 迡 ݿϰ ڸ ȯ)
+void sim_complete(SimContext* ctx, Process* p, int now) {
+    int i = process_index(ctx, p);
+
+    if (!ctx->open.enabled) {
+        ctx->table.completion_time[i] = now;
+        ctx->metrics.completed++;
+        sim_record_latency(ctx, i, now);
+        return;
+    }
+
+    Open_System* o = &ctx->open;
+
+    if (ctx->table.arrival_time[i] >= o->warmup) {
+        int turnaround = now - ctx->table.arrival_time[i];
+
+        running_stat_add(&o->turnaround, turnaround);
+        running_stat_add(&o->waiting, turnaround - ctx->table.service_time[i]);
+        running_stat_add(&o->response, ctx->table.start_time[i] - ctx->table.arrival_time[i]);
+        ctx->metrics.completed++;
+        sim_record_latency(ctx, i, now);
+    }
+
+    o->free_slot[(o->free_head + o->free_count) % ctx->process_count] = i;
+    o->free_count++;
+
+    // ̷ process  ڸ
+    if (o->blocked) {
+        o->blocked = false;
+        open_admit(ctx, &o->pending, now);
+    }
+}
+
+//  event    process  
+void sim_finish(SimContext* ctx, int end_time) {
+    ctx->gantt.end = end_time;
+    ctx->metrics.end_time = end_time;
+
+    finalize_metrics(ctx);
+}
+
+// 踦    (closed:  event, open: warm-up ~ horizon)
+int sim_elapsed(SimContext* ctx) {
+    if (ctx->open.enabled) {
+        return ctx->open.horizon - ctx->open.warmup;
+    }
+
+    return ctx->metrics.end_time;
+}
+
+// CPU process  ð 
+double sim_utilization(SimContext* ctx) {
+    int elapsed = sim_elapsed(ctx);
+
+    return elapsed > 0 ? (double)ctx->metrics.busy_time / elapsed : 0;
+}
+
+//  ð Ϸ process 
+double sim_throughput(SimContext* ctx) {
+    int elapsed = sim_elapsed(ctx);
+
+    return elapsed > 0 ? (double)ctx->metrics.completed / elapsed : 0;
+}
+
+#ifdef SIM_STATS
+// run ϳ hot path  
+void print_stats(SimContext* ctx) {
+    Sim_Stats* s = &ctx->stats;
+
+    printf("            Stats: events pushed/popped/stale = %lld/%lld/%lld, event queue purges = %lld, preemptions = %lld, context switches = %lld\n",
+        s->events_pushed, s->events_popped, s->stale_events, s->purges, s->preemptions, s->context_switches);
+    printf("                   expansions ready queue/ready heap/event queue = %lld/%lld/%lld, ready heap sift steps = %lld\n",
+        ctx->ready_queue.expansions, ctx->ready_heap.expansions, ctx->events.expansions, ctx->ready_heap.sift_steps);
+    printf("                   cycles pop/dispatch/timeline = %llu/%llu/%llu\n", (unsigned long long)s->pop_cycles,
+        (unsigned long long)s->dispatch_cycles, (unsigned long long)s->timeline_cycles);
+}
+
+// --bench JSON policy ׸ ̴  
+void print_stats_json(SimContext* ctx) {
+    Sim_Stats* s = &ctx->stats;
+
+    printf(",\"stats\":{\"events_pushed\":%lld,\"events_popped\":%lld,\"stale_events\":%lld,\"purges\":%lld,\"preemptions\":%lld,\"context_switches\":%lld,",
+        s->events_pushed, s->events_popped, s->stale_events, s->purges, s->preemptions, s->context_switches);
+    printf("\"queue_expansions\":%lld,\"ready_scan_steps\":%lld,\"pop_cycles\":%llu,\"dispatch_cycles\":%llu,\"timeline_cycles\":%llu}",
+        ctx->ready_queue.expansions + ctx->ready_heap.expansions + ctx->events.expansions, ctx->ready_heap.sift_steps,
+        (unsigned long long)s->pop_cycles, (unsigned long long)s->dispatch_cycles, (unsigned long long)s->timeline_cycles);
+}
+#endif
+
+// 迭 , ּڰ, ִ
+Metric_Summary summarize_metric(const int* values, int n) {
+    Metric_Summary summary = { 0, 0, 0 };
+    int i = 0;
+
+    if (n <= 0) {
+        return summary;
+    }
+
+    summary.min = values[0];
+    summary.max = values[0];
+
+#ifdef __AVX2__
+    // 8 min, max ϰ  64bit 4  
+    if (n >= 8) {
+        __m256i min8 = _mm256_loadu_si256((const __m256i*)values);
+        __m256i max8 = min8;
+        __m256i sum4 = _mm256_setzero_si256();
+
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+
+            min8 = _mm256_min_epi32(min8, v);
+            max8 = _mm256_max_epi32(max8, v);
+            sum4 = _mm256_add_epi64(sum4, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+            sum4 = _mm256_add_epi64(sum4, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+        }
+
+        int min_lane[8];
+        int max_lane[8];
+        long long sum_lane[4];
+
+        _mm256_storeu_si256((__m256i*)min_lane, min8);
+        _mm256_storeu_si256((__m256i*)max_lane, max8);
+        _mm256_storeu_si256((__m256i*)sum_lane, sum4);
+
+        for (int k = 0; k < 8; k++) {
+            if (min_lane[k] < summary.min) {
+                summary.min = min_lane[k];
             }
 
-            // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
+            if (max_lane[k] > summary.max) {
+                summary.max = max_lane[k];
             }
-            else {
-                break;
+        }
+
+        summary.sum = sum_lane[0] + sum_lane[1] + sum_lane[2] + sum_lane[3];
+    }
+#endif
+
+    // AVX2  ü,   κ ó (compiler ڵ vectorize )
+    long long sum = 0;
+    int min = summary.min;
+    int max = summary.max;
+
+    for (; i < n; i++) {
+        sum += values[i];
+        min = values[i] < min ? values[i] : min;
+        max = values[i] > max ? values[i] : max;
+    }
+
+    summary.sum += sum;
+    summary.min = min;
+    summary.max = max;
+
+    return summary;
+}
+
+
+
+void create_process(SimContext* ctx, Rng* rng, const Workload_Spec* spec);
+void print_process_list(SimContext* ctx);
+void run_serial(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch, bool quiet);
+void initialization(SimContext* ctx);
+void scheduling_FCFS(SimContext* ctx);
+void scheduling_Non_Preemptive_SJF(SimContext* ctx);
+void scheduling_Preemptive_SJF(SimContext* ctx);
+void scheduling_Non_Preemptive_Priority(SimContext* ctx);
+void scheduling_Preemptive_Priority(SimContext* ctx);
+void scheduling_Round_Robin(SimContext* ctx);
+void print_gantt(SimContext* ctx);
+void evaluation(SimContext* ctx);
+void run_parallel(const Workload_Spec* spec, uint64_t seed, int workload_count, int thread_count, Event_Queue_Type event_queue_type,
+    const Open_Options* open, int time_quantum, int context_switch);
+void run_sweep(const Workload_Spec* spec, uint64_t seed, int workload_count, int thread_count, Event_Queue_Type event_queue_type,
+    const Open_Options* open, int quantum_from, int quantum_to, int quantum_step, const int* context_switches, int context_switch_count);
+void print_usage(const char* program);
+void benchmark_event_queue();
+void benchmark_json(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch);
+void dump_schedules(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch);
+
+
+typedef void (*Scheduling_Function)(SimContext* ctx);
+
+typedef struct {
+    const char* name;
+    Scheduling_Function run;
+} Scheduler;
+
+//  scheduling ˰ ( )
+const Scheduler schedulers[] = {
+    { "FCFS", scheduling_FCFS },
+    { "Non-Preemptive SJF", scheduling_Non_Preemptive_SJF },
+    { "Preemptive SJF", scheduling_Preemptive_SJF },
+    { "Non-Preemptive Priority", scheduling_Non_Preemptive_Priority },
+    { "Preemptive Priority", scheduling_Preemptive_Priority },
+    { "Round Robin", scheduling_Round_Robin },
+};
+
+#define SCHEDULER_COUNT (int)(sizeof(schedulers) / sizeof(schedulers[0]))
+
+
+int main(int argc, char* argv[]) {
+    bool quiet = false; // process list, gantt chart  
+    bool bench_events = false;
+    bool bench = false;
+    bool dump = false; // main2   ֵ schedule 
+    bool parallel = false; //  ˰ thread pool ÿ 
+    int process_count = DEFAULT_PROCESS_COUNT;
+    bool process_count_set = false;
+    bool open_system = false;
+    Open_Options open = { DEFAULT_OPEN_HORIZON, 0, DEFAULT_OPEN_POOL_SIZE };
+    uint64_t seed = (uint64_t)time(NULL);
+    Workload_Spec spec = { 0, NULL, ARRIVAL_UNIFORM, 1.0, BURST_UNIFORM, 0.5 };
+    const char* workload_path = NULL;
+    bool verify = false; // workload   record ˻
+    const char* export_path = NULL; //  workload  
+    int workload_count = 1;
+    int thread_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int time_quantum = DEFAULT_TIME_QUANTUM;
+    int context_switch = 0;
+    bool sweep = false; // Round Robin time quantum sweep
+    int quantum_from = 0, quantum_to = 0, quantum_step = 1;
+    int context_switches[MAX_SWEEP_CONTEXT_SWITCHES];
+    int context_switch_count = 0;
+    Event_Queue_Type event_queue_type = EVENT_QUEUE_HEAP;
+
+    for (int i = 1; i < argc; i++) {
+        // process 
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            process_count = atoi(argv[++i]);
+            process_count_set = true;
+
+            if (process_count <= 0) {
+                print_usage(argv[0]);
+                return 1;
             }
-        } while (1);
+        }
+        else if (strcmp(argv[i], "-q") == 0) {
+            quiet = true;
+        }
+        // workload  seed ( seed  workload)
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        }
+        // open system ( ϴ process horizon simulation)
+        else if (strcmp(argv[i], "--open") == 0) {
+            open_system = true;
+        }
+        else if (strcmp(argv[i], "--horizon") == 0 && i + 1 < argc) {
+            long value = strtol(argv[++i], NULL, 10);
+            open_system = true;
 
-        // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            int shortest_index = ready_queue.front;
-            int shortest_cpu_burst = ready_queue.process[shortest_index]->remaining_cpu;
+            // event  int   ʵ  
+            if (value <= 0 || value > MAX_OPEN_HORIZON) {
+                print_usage(argv[0]);
+                return 1;
+            }
 
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+            open.horizon = (int)value;
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            long value = strtol(argv[++i], NULL, 10);
+            open_system = true;
 
-                if (ready_queue.process[idx]->remaining_cpu < shortest_cpu_burst) {
-                    shortest_cpu_burst = ready_queue.process[idx]->remaining_cpu;
-                    shortest_index = idx;
-                }
+            if (value < 0 || value > MAX_OPEN_HORIZON) {
+                print_usage(argv[0]);
+                return 1;
             }
 
-            // shortest process cpu Ҵ
-            executing_process = ready_queue.process[shortest_index];
+            open.warmup = (int)value;
+        }
+        // binary workload 
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            workload_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        }
+        // CSV binary workload Ϸ ȯ
+        else if (strcmp(argv[i], "--import-csv") == 0 && i + 2 < argc) {
+            long long count = import_csv(argv[i + 1], argv[i + 2]);
+
+            if (count < 0) {
+                return 1;
+            }
 
-            int index = shortest_index;
+            printf("Imported %lld processes into %s\n", count, argv[i + 2]);
+            return 0;
+        }
+        //  workload binary workload Ϸ 
+        else if (strcmp(argv[i], "--export-workload") == 0 && i + 1 < argc) {
+            export_path = argv[++i];
+        }
+        //  ð  (uniform | exp[:mean])
+        else if (strcmp(argv[i], "--arrival") == 0 && i + 1 < argc) {
+            i++;
 
-            // ready queue 
-            while (index != ready_queue.rear) {
-                int next = (index + 1) % ready_queue.capacity;
-                ready_queue.process[index] = ready_queue.process[next];
-                index = next;
+            if (strcmp(argv[i], "uniform") == 0) {
+                spec.arrival = ARRIVAL_UNIFORM;
             }
+            else if (strncmp(argv[i], "exp", 3) == 0 && (argv[i][3] == '\0' || (sscanf(argv[i] + 3, ":%lf", &spec.arrival_mean) == 1 && spec.arrival_mean > 0))) {
+                spec.arrival = ARRIVAL_EXPONENTIAL;
+            }
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        // burst  (uniform | lognormal | pareto | bimodal[:cpu-bound ratio])
+        else if (strcmp(argv[i], "--burst") == 0 && i + 1 < argc) {
+            i++;
 
-            // ready queue rear, count 
-            if (ready_queue.rear == 0) {
-                ready_queue.rear = ready_queue.capacity - 1;
+            if (strcmp(argv[i], "uniform") == 0) {
+                spec.burst = BURST_UNIFORM;
+            }
+            else if (strcmp(argv[i], "lognormal") == 0) {
+                spec.burst = BURST_LOGNORMAL;
+            }
+            else if (strcmp(argv[i], "pareto") == 0) {
+                spec.burst = BURST_PARETO;
+            }
+            else if (strncmp(argv[i], "bimodal", 7) == 0 && (argv[i][7] == '\0' || (sscanf(argv[i] + 7, ":%lf", &spec.cpu_bound_ratio) == 1 && spec.cpu_bound_ratio >= 0 && spec.cpu_bound_ratio <= 1))) {
+                spec.burst = BURST_BIMODAL;
             }
             else {
-                ready_queue.rear--;
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-p") == 0) {
+            parallel = true;
+        }
+        // workload  (parallel mode)
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            workload_count = atoi(argv[++i]);
+            parallel = true;
+
+            if (workload_count <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        // Round Robin time quantum
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            time_quantum = atoi(argv[++i]);
+
+            if (time_quantum <= 0) {
+                print_usage(argv[0]);
+                return 1;
             }
+        }
+        // Round Robin context switch ð
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            context_switch = atoi(argv[++i]);
 
-            ready_queue.count--;
+            if (context_switch < 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        // time quantum  (from-to[:step])
+        else if (strcmp(argv[i], "--sweep") == 0 && i + 1 < argc) {
+            int matched = sscanf(argv[++i], "%d-%d:%d", &quantum_from, &quantum_to, &quantum_step);
+            sweep = true;
 
-            // ready_queue  front, rear ʱȭ
-            if (ready_queue.count == 0) {
-                ready_queue.front = 0;
-                ready_queue.rear = 0;
+            if (matched < 2 || quantum_from <= 0 || quantum_to < quantum_from || quantum_step <= 0) {
+                print_usage(argv[0]);
+                return 1;
             }
+        }
+        // sweep  context switch ð  (a,b,c)
+        else if (strcmp(argv[i], "--cs") == 0 && i + 1 < argc) {
+            char* cursor = argv[++i];
+            context_switch_count = 0;
+
+            while (*cursor) {
+                char* end;
+                long value = strtol(cursor, &end, 10);
+
+                if (end == cursor || value < 0 || context_switch_count == MAX_SWEEP_CONTEXT_SWITCHES || (*end != ',' && *end != '\0')) {
+                    print_usage(argv[0]);
+                    return 1;
+                }
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
+                context_switches[context_switch_count++] = (int)value;
+                cursor = *end == ',' ? end + 1 : end;
             }
+        }
+        // thread  (parallel mode)
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            thread_count = atoi(argv[++i]);
 
-            to_io = executing_process->io_request_time - executing_process->executed_time;
+            if (thread_count <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        // event queue 
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+            i++;
 
-            // process IO ۾  ٽ CPU ۾ ϴ 
-            if (to_io <= 0) {
-                run = executing_process->remaining_cpu;
+            if (strcmp(argv[i], "heap") == 0) {
+                event_queue_type = EVENT_QUEUE_HEAP;
+            }
+            else if (strcmp(argv[i], "wheel") == 0) {
+                event_queue_type = EVENT_QUEUE_WHEEL;
             }
-            // process IO ۾    
             else {
-                run = to_io;
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        // event queue benchmark
+        else if (strcmp(argv[i], "--bench-events") == 0) {
+            bench_events = true;
+        }
+        // simulator ó ӵ (JSON)
+        else if (strcmp(argv[i], "--bench") == 0) {
+            bench = true;
+        }
+        // process , Ϸ    (compare_engines.sh)
+        else if (strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (bench_events) {
+        benchmark_event_queue();
+        return 0;
+    }
+
+    if (bench && !process_count_set) {
+        process_count = DEFAULT_BENCH_PROCESS_COUNT;
+    }
+
+    spec.process_count = process_count;
+
+    if (export_path) {
+        long long count = export_workload(&spec, seed, export_path);
+
+        if (count < 0) {
+            return 1;
+        }
+
+        printf("Exported %lld processes into %s\n", count, export_path);
+        return 0;
+    }
+
+    if (open_system) {
+        if (open.warmup >= open.horizon) {
+            fprintf(stderr, "--warmup must be less than --horizon\n");
+            return 1;
+        }
+
+        // open system -n ÿ system   ִ process 
+        if (process_count_set) {
+            open.pool_size = process_count;
+        }
+
+        //      ̾
+        if (spec.arrival != ARRIVAL_EXPONENTIAL) {
+            spec.arrival = ARRIVAL_EXPONENTIAL;
+            spec.arrival_mean = DEFAULT_OPEN_ARRIVAL_MEAN;
+        }
+
+        // serial mode gantt chart   Ƿ ǥ 
+        parallel = true;
+    }
+
+    Workload_File workload_file;
+
+    if (workload_path) {
+        //  workload ϳ
+        if (workload_count > 1) {
+            fprintf(stderr, "-f cannot be combined with -w\n");
+            return 1;
+        }
+
+        if (!workload_open(&workload_file, workload_path)) {
+            return 1;
+        }
+
+        if (verify && !workload_verify(&workload_file, workload_path)) {
+            workload_close(&workload_file);
+            return 1;
+        }
+
+        spec.records = workload_file.records;
+        spec.process_count = workload_file.process_count;
+
+        // open system record   ŰǷ  ð ̾ 
+        for (int k = 1; open_system && k < spec.process_count; k++) {
+            if (spec.records[k].arrival_time < spec.records[k - 1].arrival_time) {
+                fprintf(stderr, "%s: records must be sorted by arrival time for --open\n", workload_path);
+                workload_close(&workload_file);
+                return 1;
             }
+        }
+    }
+
+    if (thread_count <= 0) {
+        thread_count = 1;
+    }
+
+    if (bench) {
+        benchmark_json(&spec, seed, event_queue_type, time_quantum, context_switch);
+    }
+    else if (dump) {
+        dump_schedules(&spec, seed, event_queue_type, time_quantum, context_switch);
+    }
+    else if (sweep) {
+        if (context_switch_count == 0) {
+            context_switches[context_switch_count++] = context_switch;
+        }
+
+        run_sweep(&spec, seed, workload_count, thread_count, event_queue_type, open_system ? &open : NULL,
+            quantum_from, quantum_to, quantum_step, context_switches, context_switch_count);
+    }
+    else if (parallel) {
+        run_parallel(&spec, seed, workload_count, thread_count, event_queue_type, open_system ? &open : NULL, time_quantum, context_switch);
+    }
+    else {
+        run_serial(&spec, seed, event_queue_type, time_quantum, context_switch, quiet);
+    }
+
+    if (workload_path) {
+        workload_close(&workload_file);
+    }
+
+    return 0;
+}
+
+
+// workload ϳ   ˰ ʷ ϰ gantt chart,  
+void run_serial(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch, bool quiet) {
+    SimContext ctx;
+    sim_init(&ctx, spec->process_count, event_queue_type);
+    ctx.time_quantum = time_quantum;
+    ctx.context_switch = context_switch;
+
+    Rng rng;
+    rng_seed(&rng, seed);
+    create_process(&ctx, &rng, spec);
+
+    if (spec->records) {
+        printf("\nWorkload: %d processes from file\n", spec->process_count);
+    }
+    else {
+        printf("\nSeed: %llu\n", (unsigned long long)seed);
+    }
+
+    if (!quiet) {
+        print_process_list(&ctx);
+    }
+
+    Latency_Distribution latency;
+    ctx.latency = &latency;
+
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        latency_init(&latency);
+        initialization(&ctx);
+        printf("\n%s Scheduling\n", schedulers[k].name);
+        schedulers[k].run(&ctx);
+        if (!quiet) {
+            print_gantt(&ctx);
+        }
+        evaluation(&ctx);
+    }
+
+    sim_free(&ctx);
+}
+
+
+// rng stream workload ؼ process_list process table ٷ 
+// workload ̸ mmap record ״ 
+void create_process(SimContext* ctx, Rng* rng, const Workload_Spec* spec) {
+    double clock = 0; // ARRIVAL_EXPONENTIAL   
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        Process* p = &ctx->process_list[i];
+
+        if (spec->records) {
+            copy_record(p, &spec->records[i]);
+        }
+        else {
+            generate_process(p, i + 1, rng, spec, &clock);
+        }
+
+        reset_process(p);
+
+        ctx->table.arrival_time[i] = p->arrival_time;
+        ctx->table.service_time[i] = p->cpu_burst + p->io_burst;
+    }
+
+    if (clock >= MAX_ARRIVAL_TIME) {
+        fprintf(stderr, "workload: arrival times reached the limit %d; the remaining processes all arrive at it\n", MAX_ARRIVAL_TIME);
+    }
+}
+
+void print_process_list(SimContext* ctx) {
+    printf("\nProcess List:\n");
+    printf("PID  Priority  Arrival  CPU_Burst  IO_Request  IO_Burst\n");
+
+    for (int i = 0; i < ctx->process_count; i++) {
+        Process* p = &ctx->process_list[i];
+
+        printf("%3d  %8d  %7d  %9d  %10d  %8d\n", p->pid, p->priority, p->arrival_time, p->cpu_burst, p->io_request_time, p->io_burst);
+    }
+}
+
+void initialization(SimContext* ctx) {
+    //  run buffer  ݳϰ  arena ٽ Ҵ
+    arena_reset(&ctx->arena);
+
+    init(&ctx->ready_queue, ctx->process_count + 1, &ctx->arena);
+    waiting_init(&ctx->waiting_queue);
+    heap_init(&ctx->ready_heap, ctx->process_count + 1, &ctx->arena);
+
+    event_queue_reset(&ctx->events);
+
+    ctx->gantt.interval = NULL;
+    ctx->gantt.capacity = 0;
+    ctx->gantt.count = 0;
+    ctx->gantt.end = 0;
+
+    // process  ´   reset_process ʱȭ
+    reset_metrics(ctx);
+
+    SIM_STAT(memset(&ctx->stats, 0, sizeof(ctx->stats)));
+}
+
+// ˰򸶴 ٸ κ: ready  process  ϰ  process  
+// , CPU Ϸ, IO Ϸ ó gantt chart,   simulate  ˰  ó
+typedef struct {
+    void (*enqueue)(SimContext* ctx, Process* p); // , IO Ϸ, preemption process ready ·
+    Process* (*pick_next)(SimContext* ctx); //   process  ( NULL)
+    bool (*should_preempt)(SimContext* ctx, Process* running); // ready  running   process ִ (NULL̸ )
+    int (*quantum)(SimContext* ctx); //     ִ ִ ð (NULL̸  )
+} Policy;
+
+// FCFS, Round Robin:  
+void fifo_enqueue(SimContext* ctx, Process* p) {
+    enqueue(&ctx->ready_queue, p);
+}
+
+Process* fifo_pick_next(SimContext* ctx) {
+    return dequeue(&ctx->ready_queue);
+}
+
+// SJF:  cpu burst ª 
+void sjf_enqueue(SimContext* ctx, Process* p) {
+    heap_push(&ctx->ready_heap, p, p->remaining_cpu);
+}
+
+bool sjf_should_preempt(SimContext* ctx, Process* running) {
+    return heap_peek_key(&ctx->ready_heap) < running->remaining_cpu;
+}
+
+// Priority: priority  Ŭ 
+void priority_enqueue(SimContext* ctx, Process* p) {
+    heap_push(&ctx->ready_heap, p, -p->priority);
+}
+
+bool priority_should_preempt(SimContext* ctx, Process* running) {
+    return heap_peek(&ctx->ready_heap)->priority > running->priority;
+}
+
+Process* heap_pick_next(SimContext* ctx) {
+    return heap_pop(&ctx->ready_heap);
+}
 
-            // process ؾ ϴ ۾  
-            if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
-            }
-            // process  ϴ 
-            else {
-                executing_process->completion_time = now;
-                completed_process_count++;
-                executing_process = NULL;
-            }
-        }
-    }
+int round_robin_quantum(SimContext* ctx) {
+    return ctx->time_quantum;
+}
 
-    gantt_end = last_event_time;
+const Policy policy_FCFS = { fifo_enqueue, fifo_pick_next, NULL, NULL };
+const Policy policy_Non_Preemptive_SJF = { sjf_enqueue, heap_pick_next, NULL, NULL };
+const Policy policy_Preemptive_SJF = { sjf_enqueue, heap_pick_next, sjf_should_preempt, NULL };
+const Policy policy_Non_Preemptive_Priority = { priority_enqueue, heap_pick_next, NULL, NULL };
+const Policy policy_Preemptive_Priority = { priority_enqueue, heap_pick_next, priority_should_preempt, NULL };
+const Policy policy_Round_Robin = { fifo_enqueue, fifo_pick_next, NULL, round_robin_quantum };
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
-    }
+bool ready_is_empty(SimContext* ctx) {
+    return is_empty(&ctx->ready_queue) && heap_is_empty(&ctx->ready_heap);
 }
 
-// Preemptive SJF ˰
-void scheduling_Preemptive_SJF() {
+// policy   process Ϸ  (open system horizon) event ó
+void simulate(SimContext* ctx, const Policy* policy) {
     Process* executing_process = NULL;
+    Process* last_process = NULL; //  cpu  process (context switch Ǵ)
+
     int completed_process_count = 0;
     int last_event_time = 0; //  ó event ߻ 
     int last_run_start = 0; // executing_process   
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
-    }
+    // process  event 
+    sim_start(ctx);
+
+    while (sim_running(ctx, completed_process_count)) {
+        Event_Heap e = pop_event(ctx);
+
+        // ҵ event  Ű ʰ 
+        if (!event_live(ctx, &e)) {
+            discard_event(ctx);
+            continue;
+        }
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
         int now = e.time;
         int to_io; // IO request  ð
         int run; // CPU ۾  ð
 
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
-
-            gantt_io[t] = 0;
+        // gantt chart  (context switch  ð Idle ǥ)
+        if (executing_process) {
+            sim_execute(ctx, last_event_time > last_run_start ? last_event_time : last_run_start, now, executing_process);
         }
 
         last_event_time = now;
@@ -677,37 +2985,31 @@ void scheduling_Preemptive_SJF() {
 
             // 1. Process Arrival
             if (e.type == 1) {
-                enqueue(&ready_queue, p);
+                sim_arrive(ctx, p, now);
+                policy->enqueue(ctx, p);
             }
             // 2. CPU Complete
             else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
-
                 //  ֱٿ  cpu ۾ ð
                 p->executed_time += now - last_run_start;
                 p->remaining_cpu -= now - last_run_start;
 
                 // I/O request ߻ 
                 if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+                    gantt_mark_io(&ctx->gantt, now, p->pid);
 
                     p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
+                    waiting_enqueue(&ctx->waiting_queue, p);
                     // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
+                    push_event(ctx, now + p->remaining_io, 3, p);
                 }
-                // preemption ߻ 
+                // time quantum ų preemption ߻  ( ˰򿡼 ߻ )
                 else if (p->remaining_cpu > 0) {
-                    enqueue(&ready_queue, p);
+                    policy->enqueue(ctx, p);
                 }
                 //   process
                 else {
-                    p->completion_time = now;
+                    sim_complete(ctx, p, now);
                     completed_process_count++;
                 }
 
@@ -716,93 +3018,49 @@ void scheduling_Preemptive_SJF() {
             // 3. IO Complete
             else if (e.type == 3) {
                 p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
+                dequeue_from_waiting_queue(&ctx->waiting_queue, p);
+                policy->enqueue(ctx, p);
             }
 
             // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
-            }
-            else {
+            if (!pop_event_at(ctx, now, &e)) {
                 break;
             }
         } while (1);
 
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
+
         // preemption ߻ ˻
-        if (executing_process && !is_empty(&ready_queue)) {
+        if (policy->should_preempt && executing_process && !ready_is_empty(ctx)) {
+            // ݱ  cpu ۾ ð ݿ (preemption  pending CPU complete event  ݿ)
             executing_process->executed_time += now - last_run_start;
+            executing_process->remaining_cpu -= now - last_run_start;
 
-            int shortest_index = ready_queue.front;
-            int shortest_cpu_burst = ready_queue.process[shortest_index]->remaining_cpu;
-
-            // shortest process Ž
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+            last_run_start = now;
 
-                if (ready_queue.process[idx]->remaining_cpu < shortest_cpu_burst) {
-                    shortest_cpu_burst = ready_queue.process[idx]->remaining_cpu;
-                    shortest_index = idx;
-                }
-            }
-
-            // ready queue shortest    process ready queue push
-            if (shortest_cpu_burst < executing_process->remaining_cpu) {
-                enqueue(&ready_queue, executing_process);
+            // ready     process    process ready
+            if (policy->should_preempt(ctx, executing_process)) {
+                SIM_STAT(ctx->stats.preemptions++);
+                cancel_event(ctx, executing_process);
+                policy->enqueue(ctx, executing_process);
 
                 executing_process = NULL;
-
-                last_run_start = now;
             }
         }
 
         // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            int shortest_index = ready_queue.front;
-            int shortest_cpu_burst = ready_queue.process[shortest_index]->remaining_cpu;
+        if (!executing_process && !ready_is_empty(ctx)) {
+            executing_process = policy->pick_next(ctx);
+            ctx->metrics.dispatches++;
 
-            // shortest process Ž
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+            int quantum = policy->quantum ? policy->quantum(ctx) : 0;
 
-                if (ready_queue.process[idx]->remaining_cpu < shortest_cpu_burst) {
-                    shortest_cpu_burst = ready_queue.process[idx]->remaining_cpu;
-                    shortest_index = idx;
-                }
-            }
-
-            // shortest process cpu Ҵ
-            executing_process = ready_queue.process[shortest_index];
-
-            int index = shortest_index;
-
-            // ready queue 
-            while (index != ready_queue.rear) {
-                int next = (index + 1) % ready_queue.capacity;
-                ready_queue.process[index] = ready_queue.process[next];
-                index = next;
-            }
-
-            // ready queue rear, count 
-            if (ready_queue.rear == 0) {
-                ready_queue.rear = ready_queue.capacity - 1;
-            }
-            else {
-                ready_queue.rear--;
-            }
-
-            ready_queue.count--;
+            // time quantum  ˰򿡼  ٸ process üϴ  context switch ð ĺ 
+            int switch_time = quantum > 0 && executing_process != last_process ? ctx->context_switch : 0;
 
-            // ready_queue  front, rear ʱȭ
-            if (ready_queue.count == 0) {
-                ready_queue.front = 0;
-                ready_queue.rear = 0;
-            }
+            SIM_STAT(ctx->stats.context_switches += executing_process != last_process);
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
-            }
+            sim_dispatch(ctx, executing_process, now + switch_time);
 
             to_io = executing_process->io_request_time - executing_process->executed_time;
 
@@ -815,589 +3073,962 @@ void scheduling_Preemptive_SJF() {
                 run = to_io;
             }
 
+            // TIME QUANTUM ̸̻ TIME QUANTUMŭ ,   cpu burst    cpu burstŭ 
+            if (quantum > 0 && run >= quantum) {
+                run = executing_process->remaining_cpu < quantum ? executing_process->remaining_cpu : quantum;
+            }
+
             // process ؾ ϴ ۾  
             if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
+                last_process = executing_process;
+                last_run_start = now + switch_time;
+                push_event(ctx, last_run_start + run, 2, executing_process);
             }
             // process  ϴ 
             else {
-                executing_process->completion_time = now;
+                sim_complete(ctx, executing_process, now);
                 completed_process_count++;
                 executing_process = NULL;
             }
         }
-    }
 
-    gantt_end = last_event_time;
+        SIM_STAT(ctx->stats.dispatch_cycles += read_cycles() - dispatch_start);
+    }
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
+    // open system horizon ģ  horizon ݿ
+    if (ctx->open.enabled && executing_process) {
+        sim_execute(ctx, last_event_time > last_run_start ? last_event_time : last_run_start, ctx->open.horizon, executing_process);
     }
+
+    sim_finish(ctx, last_event_time);
+}
+
+// FCFS ˰
+void scheduling_FCFS(SimContext* ctx) {
+    simulate(ctx, &policy_FCFS);
+}
+
+// Non-Preemptive SJF ˰
+void scheduling_Non_Preemptive_SJF(SimContext* ctx) {
+    simulate(ctx, &policy_Non_Preemptive_SJF);
+}
+
+// Preemptive SJF ˰
+void scheduling_Preemptive_SJF(SimContext* ctx) {
+    simulate(ctx, &policy_Preemptive_SJF);
 }
 
 // Non-Preemptive Priority ˰
-void scheduling_Non_Preemptive_Priority() {
-    Process* executing_process = NULL;
-    int completed_process_count = 0;
-    int last_event_time = 0; //  ó event ߻ 
-    int last_run_start = 0; // executing_process   
+void scheduling_Non_Preemptive_Priority(SimContext* ctx) {
+    simulate(ctx, &policy_Non_Preemptive_Priority);
+}
+
+// Preemptive Priority ˰
+void scheduling_Preemptive_Priority(SimContext* ctx) {
+    simulate(ctx, &policy_Preemptive_Priority);
+}
+
+// Round Robin ˰
+void scheduling_Round_Robin(SimContext* ctx) {
+    simulate(ctx, &policy_Round_Robin);
+}
+
+void print_gantt(SimContext* ctx) {
+    int width = 10;
+
+    printf("\nGantt Chart:\nTime :");
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
+    for (int t = 0; t <= ctx->gantt.end; t++) {
+        printf("%*d", width, t);
     }
+    printf("\n ");
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
-        int now = e.time;
-        int to_io; // IO request  ð
-        int run; // CPU ۾  ð
+    for (int t = 0; t <= ctx->gantt.end; t++) {
+        for (int i = 0; i < width; i++) {
+            printf("-");
+        }
+    }
 
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
+    printf("\nPID  :");
 
-            gantt_io[t] = 0;
+    int k = 0; // t ϰų t Ŀ ϴ ù 
+
+    for (int t = 0; t <= ctx->gantt.end; t++) {
+        while (k < ctx->gantt.count && ctx->gantt.interval[k].end <= t) {
+            k++;
         }
 
-        last_event_time = now;
+        // Idle 
+        if (k == ctx->gantt.count || ctx->gantt.interval[k].start > t) {
+            printf("|%*s", width - 1, "Idle");
+        }
+        // I/O request Ǳ  
+        else if (ctx->gantt.interval[k].io && t == ctx->gantt.interval[k].end - 1) {
+            char buffer[width + 1];
+            snprintf(buffer, sizeof(buffer), "P%d(I/O)", ctx->gantt.interval[k].pid);
+            printf("| %*s", width - 2, buffer);
+        }
+        //   process
+        else {
+            char buffer[width + 1];
+            snprintf(buffer, sizeof(buffer), "P%d", ctx->gantt.interval[k].pid);
+            printf("| %*s", width - 2, buffer);
+        }
+    }
 
-        do {
-            Process* p = e.p;
+    printf("|\n");
+}
 
-            // 1. Process Arrival
-            if (e.type == 1) {
-                enqueue(&ready_queue, p);
-            }
-            // 2. CPU Complete
-            else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
+void evaluation(SimContext* ctx) {
+    Metric_Summary waiting = summarize_metric(ctx->table.waiting_time, ctx->process_count);
+    Metric_Summary turnaround = summarize_metric(ctx->table.turnaround_time, ctx->process_count);
 
-                //  ֱٿ  cpu ۾ ð
-                p->executed_time += now - last_run_start;
-                p->remaining_cpu -= now - last_run_start;
+    double average_waiting_time = (double)waiting.sum / ctx->process_count;
+    double average_turnaround_time = (double)turnaround.sum / ctx->process_count;
 
-                // I/O request ߻ 
-                if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+    printf("\nEvaluation: Average waiting time = %.2f, Average turnaround time = %.2f\n", average_waiting_time, average_turnaround_time);
+    printf("            Waiting time min/max = %d/%d, Turnaround time min/max = %d/%d\n", waiting.min, waiting.max, turnaround.min, turnaround.max);
 
-                    p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
-                    // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
-                }
-                //   process
-                else {
-                    p->completion_time = now;
-                    completed_process_count++;
-                }
+    Run_Metrics* m = &ctx->metrics;
+    double average_response_time = m->responded > 0 ? (double)m->response_sum / m->responded : 0;
 
-                executing_process = NULL;
-            }
-            // 3. IO Complete
-            else if (e.type == 3) {
-                p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
-            }
+    printf("            Average response time = %.2f, CPU utilization = %.2f%%, Idle time = %lld, Throughput = %.4f\n", average_response_time,
+        sim_utilization(ctx) * 100, sim_elapsed(ctx) - m->busy_time, sim_throughput(ctx));
 
-            // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
-            }
-            else {
-                break;
+    SIM_STAT(print_stats(ctx));
+
+    if (!ctx->latency) {
+        return;
+    }
+
+    const char* name[3] = { "Waiting time", "Turnaround time", "Response time" };
+
+    for (int m = 0; m < 3; m++) {
+        const Histogram* h = latency_metric(ctx->latency, m);
+
+        printf("            %-15s p50/p90/p99/p99.9/max = %d/%d/%d/%d/%d\n", name[m], histogram_percentile(h, 0.5), histogram_percentile(h, 0.9),
+            histogram_percentile(h, 0.99), histogram_percentile(h, 0.999), h->max);
+    }
+}
+
+//  (workload, )  
+typedef struct {
+    double average_waiting_time;
+    double average_turnaround_time;
+    double average_response_time;
+    double utilization; // CPU process  ð 
+    double throughput; //  ð Ϸ process 
+    long long completed; // 迡 ݿ process 
+    int peak_active; // open system ÿ system ִ ִ process 
+    long long deferred; // open system  ڸ   ̷ process 
+} Job_Result;
+
+// job ϳ  ˰ Round Robin 
+typedef struct {
+    const Scheduler* scheduler;
+    int time_quantum;
+    int context_switch;
+} Job_Config;
+
+// worker ϳ ִ job deque, [top, bottom)  job ȣ 
+// owner bottom , ڱ deque  worker ٸ deque top İ
+// (workload  ð ũ ޶  йδ Ϻ thread ʰ )
+typedef struct {
+    pthread_mutex_t lock;
+    int top;
+    int bottom;
+} Job_Deque;
+
+// job = workload * config_count + config
+typedef struct {
+    const Workload_Spec* spec;
+    Rng* streams; // workload  rng stream (job  stream workload ٽ )
+    int workload_count;
+    Event_Queue_Type event_queue_type;
+    const Open_Options* open; // NULL̸ closed system
+
+    const Job_Config* configs;
+    int config_count;
+
+    Job_Result* results;
+    int job_count;
+
+    // thread * config_count + config,   thread 0 ڸ config merge
+    // (thread  ϹǷ lock  , NULL̸  )
+    Latency_Distribution* latency;
+
+    Job_Deque* deques;
+    int thread_count;
+    int steal_count;
+    double elapsed; // 
+} Job_Pool;
+
+typedef struct {
+    Job_Pool* pool;
+    int id;
+    int steal_count;
+} Worker;
+
+// owner ʿ job ϳ ,   -1
+int deque_pop(Job_Deque* d) {
+    int job = -1;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->top < d->bottom) {
+        job = --d->bottom;
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    return job;
+}
+
+// ٸ worker ʿ job ϳ ħ,   -1
+int deque_steal(Job_Deque* d) {
+    int job = -1;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->top < d->bottom) {
+        job = d->top++;
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    return job;
+}
+
+// job ϳ worker context , context job ̿ ϹǷ Ź  ä
+void run_job(Worker* worker, int job, SimContext* ctx) {
+    Job_Pool* pool = worker->pool;
+    Rng rng = pool->streams[job / pool->config_count];
+    const Job_Config* config = &pool->configs[job % pool->config_count];
+    Job_Result* result = &pool->results[job];
+
+    //  job workload  ؼ 
+    if (!pool->open) {
+        create_process(ctx, &rng, pool->spec);
+    }
+
+    ctx->time_quantum = config->time_quantum;
+    ctx->context_switch = config->context_switch;
+    ctx->latency = pool->latency ? &pool->latency[worker->id * pool->config_count + job % pool->config_count] : NULL;
+
+    initialization(ctx);
+
+    if (pool->open) {
+        sim_open(ctx, pool->spec, &rng, pool->open->horizon, pool->open->warmup);
+    }
+
+    config->scheduler->run(ctx);
+
+    result->utilization = sim_utilization(ctx);
+    result->throughput = sim_throughput(ctx);
+
+    if (pool->open) {
+        result->average_waiting_time = ctx->open.waiting.mean;
+        result->average_turnaround_time = ctx->open.turnaround.mean;
+        result->average_response_time = ctx->open.response.mean;
+        result->completed = ctx->open.turnaround.count;
+        result->peak_active = ctx->open.peak_active;
+        result->deferred = ctx->open.deferred;
+
+        return;
+    }
+
+    Metric_Summary waiting = summarize_metric(ctx->table.waiting_time, ctx->process_count);
+    Metric_Summary turnaround = summarize_metric(ctx->table.turnaround_time, ctx->process_count);
+
+    result->average_waiting_time = (double)waiting.sum / ctx->process_count;
+    result->average_turnaround_time = (double)turnaround.sum / ctx->process_count;
+    result->average_response_time = (double)ctx->metrics.response_sum / ctx->process_count;
+    result->completed = ctx->process_count;
+    result->peak_active = ctx->process_count;
+    result->deferred = 0;
+}
+
+void* worker_main(void* arg) {
+    Worker* worker = arg;
+    Job_Pool* pool = worker->pool;
+
+    // worker context ϳ job ̿  (arena ũⰡ  ڿ job heap Ҵ )
+    SimContext ctx;
+    sim_init(&ctx, pool->open ? pool->open->pool_size : pool->spec->process_count, pool->event_queue_type);
+
+    while (1) {
+        int job = deque_pop(&pool->deques[worker->id]);
+
+        // ڱ deque   worker ʷ ĺ
+        for (int i = 1; job < 0 && i < pool->thread_count; i++) {
+            job = deque_steal(&pool->deques[(worker->id + i) % pool->thread_count]);
+
+            if (job >= 0) {
+                worker->steal_count++;
             }
-        } while (1);
+        }
 
-        // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            int best_index = ready_queue.front;
-            int best_priority = ready_queue.process[best_index]->priority;
+        //  job  Ƿ  deque  
+        if (job < 0) {
+            break;
+        }
+
+        run_job(worker, job, &ctx);
+    }
+
+    sim_free(&ctx);
+
+    return NULL;
+}
+
+double elapsed_seconds(struct timespec start, struct timespec end) {
+    return (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// workload_count workload x config_count  work-stealing thread pool 
+//  pool->results workload  , record_latency config  pool->latency[config] 
+void run_pool(Job_Pool* pool, const Workload_Spec* spec, uint64_t seed, int workload_count, int thread_count, Event_Queue_Type event_queue_type,
+    const Open_Options* open, const Job_Config* configs, int config_count, bool record_latency) {
+    pool->spec = spec;
+    pool->open = open;
+    pool->workload_count = workload_count;
+    pool->event_queue_type = event_queue_type;
+    pool->configs = configs;
+    pool->config_count = config_count;
+    pool->job_count = workload_count * config_count;
+
+    if (thread_count > pool->job_count) {
+        thread_count = pool->job_count;
+    }
+
+    pool->thread_count = thread_count;
+    pool->streams = xmalloc(sizeof(Rng) * workload_count);
+    pool->results = xmalloc(sizeof(Job_Result) * pool->job_count);
+    pool->deques = xmalloc(sizeof(Job_Deque) * thread_count);
+    pool->latency = record_latency ? xcalloc((size_t)thread_count * config_count, sizeof(Latency_Distribution)) : NULL;
+
+    pthread_t* threads = xmalloc(sizeof(pthread_t) * thread_count);
+    Worker* workers = xmalloc(sizeof(Worker) * thread_count);
+
+    if (!pool->streams || !pool->results || !pool->deques || (record_latency && !pool->latency) || !threads || !workers) {
+        fprintf(stderr, "parallel: out of memory (%d workloads, %d threads)\n", workload_count, thread_count);
+        exit(1);
+    }
+
+    // workload w seed stream w jump stream  (thread  ϰ  )
+    rng_seed(&pool->streams[0], seed);
+
+    for (int w = 1; w < workload_count; w++) {
+        pool->streams[w] = pool->streams[w - 1];
+        rng_jump(&pool->streams[w]);
+    }
+
+    // job ӵ    worker deque 
+    for (int i = 0; i < thread_count; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].top = (int)((long long)pool->job_count * i / thread_count);
+        pool->deques[i].bottom = (int)((long long)pool->job_count * (i + 1) / thread_count);
+
+        workers[i].pool = pool;
+        workers[i].id = i;
+        workers[i].steal_count = 0;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < thread_count; i++) {
+        if (pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0) {
+            fprintf(stderr, "parallel: failed to create thread %d\n", i);
+            exit(1);
+        }
+    }
+
+    pool->steal_count = 0;
+
+    for (int i = 0; i < thread_count; i++) {
+        pthread_join(threads[i], NULL);
+        pool->steal_count += workers[i].steal_count;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    pool->elapsed = elapsed_seconds(start, end);
+
+    for (int i = 0; i < thread_count; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+
+    // thread  config ħ
+    for (int i = 1; pool->latency && i < thread_count; i++) {
+        for (int k = 0; k < config_count; k++) {
+            latency_merge(&pool->latency[k], &pool->latency[i * config_count + k]);
+        }
+    }
+
+    free(threads);
+    free(workers);
+    free(pool->streams);
+    free(pool->deques);
+}
+
+typedef struct {
+    double mean;
+    double stddev; // ǥ ǥ
+    double ci; // 95% ŷڱ  (ǥ 1 0)
+} Sample_Stats;
+
+//  95% t  Ӱ谪 ( 1 ~ 30),  ̻ Ժ ٻ
+const double t_critical_95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+Sample_Stats sample_stats(const double* x, int n) {
+    Sample_Stats s = { 0, 0, 0 };
+
+    for (int i = 0; i < n; i++) {
+        s.mean += x[i];
+    }
+    s.mean /= n;
+
+    if (n < 2) {
+        return s;
+    }
+
+    double squares = 0;
+
+    for (int i = 0; i < n; i++) {
+        squares += (x[i] - s.mean) * (x[i] - s.mean);
+    }
+
+    int df = n - 1;
+    double t = df <= 30 ? t_critical_95[df - 1] : 1.96;
+
+    s.stddev = sqrt(squares / df);
+    s.ci = t * s.stddev / sqrt(n);
+
+    return s;
+}
+
+// config°   workload   
+// metric 0: waiting, 1: turnaround, 2: response, 3: utilization, 4: throughput
+double job_metric(const Job_Result* r, int metric) {
+    if (metric == 0) {
+        return r->average_waiting_time;
+    }
+    else if (metric == 1) {
+        return r->average_turnaround_time;
+    }
+    else if (metric == 2) {
+        return r->average_response_time;
+    }
+    else if (metric == 3) {
+        return r->utilization;
+    }
+
+    return r->throughput;
+}
+
+Sample_Stats config_stats(Job_Pool* pool, int config, double* buffer, int metric) {
+    for (int w = 0; w < pool->workload_count; w++) {
+        Job_Result* r = &pool->results[w * pool->config_count + config];
+
+        buffer[w] = job_metric(r, metric);
+    }
+
+    return sample_stats(buffer, pool->workload_count);
+}
+
+// ˰򺰷  workload հ  , ǥ, 95% ŷڱ 
+void print_comparison(Job_Pool* pool) {
+    double* buffer = xmalloc(sizeof(double) * pool->workload_count);
+
+    if (!buffer) {
+        fprintf(stderr, "parallel: out of memory (%d workloads)\n", pool->workload_count);
+        exit(1);
+    }
+
+    printf("\n%-24s  %10s  %10s  %12s  %10s  %10s  %12s\n", "Policy", "Waiting", "Stddev", "95% CI", "Turnaround", "Stddev", "95% CI");
+
+    for (int k = 0; k < pool->config_count; k++) {
+        Sample_Stats ws = config_stats(pool, k, buffer, 0);
+        Sample_Stats ts = config_stats(pool, k, buffer, 1);
+
+        char waiting_ci[32];
+        char turnaround_ci[32];
+        snprintf(waiting_ci, sizeof(waiting_ci), "+/- %.2f", ws.ci);
+        snprintf(turnaround_ci, sizeof(turnaround_ci), "+/- %.2f", ts.ci);
+
+        printf("%-24s  %10.2f  %10.2f  %12s  %10.2f  %10.2f  %12s\n", pool->configs[k].scheduler->name, ws.mean, ws.stddev, waiting_ci, ts.mean, ts.stddev, turnaround_ci);
+    }
 
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+    // open system print_open_summary 
+    if (!pool->open) {
+        printf("\n%-24s  %10s  %12s  %11s  %10s\n", "Policy", "Response", "95% CI", "Utilization", "Throughput");
 
-                if (ready_queue.process[idx]->priority > best_priority) {
-                    best_priority = ready_queue.process[idx]->priority;
-                    best_index = idx;
-                }
-            }
+        for (int k = 0; k < pool->config_count; k++) {
+            Sample_Stats rs = config_stats(pool, k, buffer, 2);
+            Sample_Stats us = config_stats(pool, k, buffer, 3);
+            Sample_Stats xs = config_stats(pool, k, buffer, 4);
 
-            // best priority cpu Ҵ
-            executing_process = ready_queue.process[best_index];
+            char response_ci[32];
+            snprintf(response_ci, sizeof(response_ci), "+/- %.2f", rs.ci);
 
-            int idx = best_index;
+            printf("%-24s  %10.2f  %12s  %10.2f%%  %10.4f\n", pool->configs[k].scheduler->name, rs.mean, response_ci, us.mean * 100, xs.mean);
+        }
+    }
 
-            // ready queue 
-            while (idx != ready_queue.rear) {
-                int next = (idx + 1) % ready_queue.capacity;
-                ready_queue.process[idx] = ready_queue.process[next];
-                idx = next;
-            }
+    free(buffer);
 
-            // ready queue rear, count 
-            if (ready_queue.rear == 0) {
-                ready_queue.rear = ready_queue.capacity - 1;
-            }
-            else {
-                ready_queue.rear--;
-            }
+    if (!pool->latency) {
+        return;
+    }
 
-            ready_queue.count--;
+    //  workload process ģ 
+    const char* name[3] = { "Waiting time", "Turnaround time", "Response time" };
 
-            // ready_queue  front, rear ʱȭ
-            if (ready_queue.count == 0) {
-                ready_queue.front = 0;
-                ready_queue.rear = 0;
-            }
+    for (int m = 0; m < 3; m++) {
+        printf("\n%-24s  %10s  %10s  %10s  %10s  %10s  (%s)\n", "Policy", "p50", "p90", "p99", "p99.9", "max", name[m]);
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
-            }
+        for (int k = 0; k < pool->config_count; k++) {
+            const Histogram* h = latency_metric(&pool->latency[k], m);
 
-            to_io = executing_process->io_request_time - executing_process->executed_time;
+            printf("%-24s  %10d  %10d  %10d  %10d  %10d\n", pool->configs[k].scheduler->name, histogram_percentile(h, 0.5), histogram_percentile(h, 0.9),
+                histogram_percentile(h, 0.99), histogram_percentile(h, 0.999), h->max);
+        }
+    }
+}
 
-            // process IO ۾  ٽ CPU ۾ ϴ 
-            if (to_io <= 0) {
-                run = executing_process->remaining_cpu;
-            }
-            // process IO ۾    
-            else {
-                run = to_io;
-            }
+// ǥ   workload ũ
+const char* workload_size(const Workload_Spec* spec, const Open_Options* open, char* buffer, size_t size) {
+    if (open) {
+        snprintf(buffer, size, "open system");
+    }
+    else {
+        snprintf(buffer, size, "%d processes", spec->process_count);
+    }
 
-            // process ؾ ϴ ۾  
-            if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
-            }
-            // process  ϴ 
-            else {
-                executing_process->completion_time = now;
-                completed_process_count++;
-                executing_process = NULL;
-            }
+    return buffer;
+}
 
-        }
+// open system   (closed system̸  )
+void print_open_header(const Workload_Spec* spec, const Open_Options* open) {
+    if (!open) {
+        return;
     }
 
-    gantt_end = last_event_time;
+    printf("Open system: horizon %d, warm-up %d, process pool %d, ", open->horizon, open->warmup, open->pool_size);
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
+    if (spec->records) {
+        printf("arrivals from workload file\n");
+    }
+    else {
+        printf("mean inter-arrival time %.2f\n", spec->arrival_mean);
     }
 }
 
-// Preemptive Priority ˰
-void scheduling_Preemptive_Priority() {
-    Process* executing_process = NULL;
-    int completed_process_count = 0;
-    int last_event_time = 0; //  ó event ߻ 
-    int last_run_start = 0; // executing_process   
+// ˰ open system ó (warm-up  Ϸ process )
+void print_open_summary(Job_Pool* pool, const Open_Options* open) {
+    double* buffer = xmalloc(sizeof(double) * pool->workload_count);
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
+    if (!buffer) {
+        fprintf(stderr, "parallel: out of memory (%d workloads)\n", pool->workload_count);
+        exit(1);
     }
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
-        int now = e.time;
-        int to_io; // IO request  ð
-        int run; // CPU ۾  ð
+    printf("\n%-24s  %12s  %10s  %11s  %8s  %10s  %10s  %12s\n", "Policy", "Completed", "Throughput", "Utilization", "Peak", "Deferred", "Response",
+        "95% CI");
 
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
+    for (int k = 0; k < pool->config_count; k++) {
+        long long completed = 0;
+        long long deferred = 0;
+        int peak_active = 0;
 
-            gantt_io[t] = 0;
+        for (int w = 0; w < pool->workload_count; w++) {
+            Job_Result* r = &pool->results[w * pool->config_count + k];
+
+            completed += r->completed;
+            deferred += r->deferred;
+
+            if (r->peak_active > peak_active) {
+                peak_active = r->peak_active;
+            }
         }
 
-        last_event_time = now;
+        Sample_Stats rs = config_stats(pool, k, buffer, 2);
+        Sample_Stats us = config_stats(pool, k, buffer, 3);
+        double per_workload = (double)completed / pool->workload_count;
 
-        do {
-            Process* p = e.p;
+        char response_ci[32];
+        snprintf(response_ci, sizeof(response_ci), "+/- %.2f", rs.ci);
 
-            // 1. Process Arrival
-            if (e.type == 1) {
-                enqueue(&ready_queue, p);
-            }
-            // 2. CPU Complete
-            else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
+        printf("%-24s  %12.0f  %10.4f  %10.2f%%  %8d  %10.0f  %10.2f  %12s\n", pool->configs[k].scheduler->name, per_workload,
+            per_workload / (open->horizon - open->warmup), us.mean * 100, peak_active, (double)deferred / pool->workload_count, rs.mean,
+            response_ci);
+    }
 
-                //  ֱٿ  cpu ۾ ð
-                p->executed_time += now - last_run_start;
-                p->remaining_cpu -= now - last_run_start;
+    free(buffer);
+}
 
-                // I/O request ߻ 
-                if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+//  ˰  workload鿡  ÿ ϰ ǥ 
+void run_parallel(const Workload_Spec* spec, uint64_t seed, int workload_count, int thread_count, Event_Queue_Type event_queue_type,
+    const Open_Options* open, int time_quantum, int context_switch) {
+    Job_Config configs[SCHEDULER_COUNT];
 
-                    p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
-                    // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
-                }
-                // preemption ߻ 
-                else if (p->remaining_cpu > 0) {
-                    enqueue(&ready_queue, p);
-                }
-                //   process
-                else {
-                    p->completion_time = now;
-                    completed_process_count++;
-                }
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        configs[k].scheduler = &schedulers[k];
+        configs[k].time_quantum = time_quantum;
+        configs[k].context_switch = context_switch;
+    }
 
-                executing_process = NULL;
-            }
-            // 3. IO Complete
-            else if (e.type == 3) {
-                p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
-            }
+    Job_Pool pool;
+    char size[32];
+    run_pool(&pool, spec, seed, workload_count, thread_count, event_queue_type, open, configs, SCHEDULER_COUNT, true);
 
-            // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
-            }
-            else {
-                break;
-            }
-        } while (1);
+    printf("\nParallel evaluation: %d workload(s) x %d policies, %s, seed %llu, %d thread(s), %d steal(s), %.3f s\n",
+        workload_count, SCHEDULER_COUNT, workload_size(spec, open, size, sizeof(size)), (unsigned long long)seed, pool.thread_count, pool.steal_count, pool.elapsed);
+    print_open_header(spec, open);
+    print_comparison(&pool);
 
-        // preemption ߻ ˻
-        if (executing_process && !is_empty(&ready_queue)) {
-            executing_process->executed_time += now - last_run_start;
+    if (open) {
+        print_open_summary(&pool, open);
+    }
 
-            int best_index = ready_queue.front;
-            int best_priority = ready_queue.process[best_index]->priority;
+    free(pool.results);
+    free(pool.latency);
+}
 
-            // best priority Ž
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+//  (x[i], y[i]) knee:   մ   ָ   (Kneedle)
+// x, y [0, 1] ȭؼ ϸ,  3 ̸̰ų ̸ -1
+int find_knee(const double* x, const double* y, int n) {
+    if (n < 3) {
+        return -1;
+    }
 
-                if (ready_queue.process[idx]->priority > best_priority) {
-                    best_priority = ready_queue.process[idx]->priority;
-                    best_index = idx;
-                }
-            }
+    double y_min = y[0];
+    double y_max = y[0];
 
-            // ready queue shortest    process ready queue push
-            if (best_priority > executing_process->priority) {
-                enqueue(&ready_queue, executing_process);
+    for (int i = 1; i < n; i++) {
+        if (y[i] < y_min) {
+            y_min = y[i];
+        }
+        if (y[i] > y_max) {
+            y_max = y[i];
+        }
+    }
 
-                executing_process = NULL;
+    if (y_max == y_min) {
+        return -1;
+    }
 
-                last_run_start = now;
-            }
+    double x_range = x[n - 1] - x[0];
+    double y_first = (y[0] - y_min) / (y_max - y_min);
+    double y_last = (y[n - 1] - y_min) / (y_max - y_min);
+    int knee = -1;
+    double farthest = 0;
+
+    for (int i = 1; i < n - 1; i++) {
+        double xi = (x[i] - x[0]) / x_range;
+        double yi = (y[i] - y_min) / (y_max - y_min);
+        double distance = fabs(yi - (y_first + (y_last - y_first) * xi));
+
+        if (distance > farthest) {
+            farthest = distance;
+            knee = i;
         }
+    }
 
-        // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            int best_index = ready_queue.front;
-            int best_priority = ready_queue.process[best_index]->priority;
+    return knee;
+}
 
-            for (int k = 0; k < ready_queue.count; k++) {
-                int idx = (ready_queue.front + k) % ready_queue.capacity;
+// Round Robin time quantum (x context switch ð)   workload鿡  ÿ 
+void run_sweep(const Workload_Spec* spec, uint64_t seed, int workload_count, int thread_count, Event_Queue_Type event_queue_type,
+    const Open_Options* open, int quantum_from, int quantum_to, int quantum_step, const int* context_switches, int context_switch_count) {
+    int quantum_count = (quantum_to - quantum_from) / quantum_step + 1;
+    int config_count = quantum_count * context_switch_count;
+
+    // config = context switch * quantum_count + quantum
+    Job_Config* configs = xcalloc(config_count, sizeof(Job_Config));
+    double* buffer = xmalloc(sizeof(double) * workload_count);
+    double* quantum = xmalloc(sizeof(double) * quantum_count);
+    double* waiting = xmalloc(sizeof(double) * quantum_count);
+
+    if (!configs || !buffer || !quantum || !waiting) {
+        fprintf(stderr, "sweep: out of memory (%d settings)\n", config_count);
+        exit(1);
+    }
 
-                if (ready_queue.process[idx]->priority > best_priority) {
-                    best_priority = ready_queue.process[idx]->priority;
-                    best_index = idx;
-                }
-            }
+    for (int c = 0; c < context_switch_count; c++) {
+        for (int q = 0; q < quantum_count; q++) {
+            Job_Config* config = &configs[c * quantum_count + q];
 
-            // best priority cpu Ҵ
-            executing_process = ready_queue.process[best_index];
+            config->scheduler = &schedulers[SCHEDULER_COUNT - 1]; // Round Robin
+            config->time_quantum = quantum_from + q * quantum_step;
+            config->context_switch = context_switches[c];
+        }
+    }
 
-            int idx = best_index;
+    Job_Pool pool;
+    char size[32];
+    run_pool(&pool, spec, seed, workload_count, thread_count, event_queue_type, open, configs, config_count, false);
 
-            // ready queue 
-            while (idx != ready_queue.rear) {
-                int next = (idx + 1) % ready_queue.capacity;
-                ready_queue.process[idx] = ready_queue.process[next];
-                idx = next;
-            }
+    printf("\nRound Robin quantum sweep: %d workload(s) x %d setting(s), %s, seed %llu, %d thread(s), %d steal(s), %.3f s\n",
+        workload_count, config_count, workload_size(spec, open, size, sizeof(size)), (unsigned long long)seed, pool.thread_count, pool.steal_count, pool.elapsed);
+    print_open_header(spec, open);
 
-            // ready queue rear, count 
-            if (ready_queue.rear == 0) {
-                ready_queue.rear = ready_queue.capacity - 1;
-            }
-            else {
-                ready_queue.rear--;
-            }
+    for (int c = 0; c < context_switch_count; c++) {
+        int best_waiting = 0;
+        int best_response = 0;
+        double best_response_time = 0;
 
-            ready_queue.count--;
+        printf("\nContext switch = %d\n", context_switches[c]);
+        printf("%8s  %10s  %12s  %10s  %12s  %10s  %12s\n", "Quantum", "Waiting", "95% CI", "Turnaround", "95% CI", "Response", "95% CI");
 
-            // ready_queue  front, rear ʱȭ
-            if (ready_queue.count == 0) {
-                ready_queue.front = 0;
-                ready_queue.rear = 0;
-            }
+        for (int q = 0; q < quantum_count; q++) {
+            int k = c * quantum_count + q;
+            Sample_Stats ws = config_stats(&pool, k, buffer, 0);
+            Sample_Stats ts = config_stats(&pool, k, buffer, 1);
+            Sample_Stats rs = config_stats(&pool, k, buffer, 2);
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
-            }
+            char waiting_ci[32];
+            char turnaround_ci[32];
+            char response_ci[32];
+            snprintf(waiting_ci, sizeof(waiting_ci), "+/- %.2f", ws.ci);
+            snprintf(turnaround_ci, sizeof(turnaround_ci), "+/- %.2f", ts.ci);
+            snprintf(response_ci, sizeof(response_ci), "+/- %.2f", rs.ci);
 
-            to_io = executing_process->io_request_time - executing_process->executed_time;
+            printf("%8d  %10.2f  %12s  %10.2f  %12s  %10.2f  %12s\n", configs[k].time_quantum, ws.mean, waiting_ci, ts.mean, turnaround_ci, rs.mean, response_ci);
 
-            // process IO ۾  ٽ CPU ۾ ϴ 
-            if (to_io <= 0) {
-                run = executing_process->remaining_cpu;
-            }
-            // process IO ۾    
-            else {
-                run = to_io;
-            }
+            quantum[q] = configs[k].time_quantum;
+            waiting[q] = ws.mean;
 
-            // process ؾ ϴ ۾  
-            if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
+            if (ws.mean < waiting[best_waiting]) {
+                best_waiting = q;
             }
-            // process  ϴ 
-            else {
-                executing_process->completion_time = now;
-                completed_process_count++;
-                executing_process = NULL;
+            if (q == 0 || rs.mean < best_response_time) {
+                best_response = q;
+                best_response_time = rs.mean;
             }
+        }
 
+        int knee = find_knee(quantum, waiting, quantum_count);
+
+        if (knee < 0) {
+            printf("Knee: none");
+        }
+        else {
+            printf("Knee: quantum %d", (int)quantum[knee]);
         }
+        printf(", lowest waiting: quantum %d, lowest response: quantum %d\n", (int)quantum[best_waiting], (int)quantum[best_response]);
     }
 
-    gantt_end = last_event_time;
+    free(configs);
+    free(buffer);
+    free(quantum);
+    free(waiting);
+    free(pool.results);
+}
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
-    }
+void print_usage(const char* program) {
+    printf("Usage: %s [-n count] [-q] [-s seed] [-f file] [--verify] [--import-csv in out] [--export-workload out]\n", program);
+    printf("          [--arrival dist] [--burst dist] [-e heap|wheel] [-t quantum] [-c cost]\n");
+    printf("          [-p] [-w count] [-j threads] [--sweep from-to[:step]] [--cs a,b,...]\n");
+    printf("          [--open] [--horizon time] [--warmup time] [--bench-events] [--bench] [--dump]\n");
+    printf("  -n count         number of processes (default: %d)\n", DEFAULT_PROCESS_COUNT);
+    printf("  -q               do not print the process list and gantt charts\n");
+    printf("  -s seed          workload seed (default: current time)\n");
+    printf("  -f file          run a binary workload file instead of a random workload\n");
+    printf("  --verify         check every record and pid of the -f file before running\n");
+    printf("                   (files written by --import-csv and --export-workload are valid when written)\n");
+    printf("  --import-csv in.csv out.wl\n");
+    printf("                   convert a CSV process list (PID,Priority,Arrival,CPU_Burst,IO_Request,IO_Burst)\n");
+    printf("                   into a binary workload file\n");
+    printf("  --export-workload out.wl\n");
+    printf("                   write the -n/-s/--arrival/--burst workload as a binary workload file\n");
+    printf("                   (main -f and main2 -f then run the same processes)\n");
+    printf("  --arrival uniform|exp[:mean]\n");
+    printf("                   arrival times: uniform 0-9, or exponential inter-arrival gaps (default mean 1)\n");
+    printf("  --burst uniform|lognormal|pareto|bimodal[:ratio]\n");
+    printf("                   cpu/io bursts (bimodal: fraction of cpu-bound processes, default 0.5)\n");
+    printf("  -t quantum       Round Robin time quantum (default: %d)\n", DEFAULT_TIME_QUANTUM);
+    printf("  -c cost          Round Robin context switch cost (default: 0)\n");
+    printf("  -p               run all policies in parallel and print a comparison table\n");
+    printf("  -w count         Monte Carlo batch: number of random workloads for -p (default: 1, implies -p)\n");
+    printf("  -j threads       worker threads for -p and --sweep (default: online CPUs)\n");
+    printf("  --sweep from-to[:step]\n");
+    printf("                   evaluate Round Robin over a range of time quanta on the -w workloads\n");
+    printf("  --cs a,b,...     context switch costs to sweep (default: the -c cost)\n");
+    printf("  -e heap|wheel    event queue (default: heap)\n");
+    printf("  --open           open system: processes keep arriving (exponential gaps, default mean %.0f)\n", DEFAULT_OPEN_ARRIVAL_MEAN);
+    printf("                   in a recycled pool of -n slots (default: %d) until the horizon\n", DEFAULT_OPEN_POOL_SIZE);
+    printf("  --horizon time   open system end time (default: %d, implies --open)\n", DEFAULT_OPEN_HORIZON);
+    printf("  --warmup time    exclude processes arriving before this time (default: 0, implies --open)\n");
+    printf("  --bench-events   event queue benchmark (heap vs timing wheel)\n");
+    printf("  --bench          run every policy once on the -n (default: %d) process workload and print\n", DEFAULT_BENCH_PROCESS_COUNT);
+    printf("                   events/s, ns/event, dispatches/s, ns/dispatch, allocations and peak RSS as one line of JSON\n");
+    printf("  --dump           print each policy's per-process start/completion times and run intervals\n");
+    printf("                   in the format of main2 --dump (see compare_engines.sh)\n");
 }
 
-// Round Robin ˰
-void scheduling_Round_Robin() {
-    Process* executing_process = NULL;
-    int completed_process_count = 0;
-    int last_event_time = 0; //  ó event ߻ 
-    int last_run_start = 0; // executing_process   
+// hold model:  ̸ event popϰ   +  ٽ push
+double benchmark_hold(Event_Queue_Type type, int size, int max_increment, int operations, uint64_t seed) {
+    int increment[4096];
+    Rng rng;
+    rng_seed(&rng, seed);
 
-    // process  ð  event heap push
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        push_event(process_list[i].arrival_time, 1, &process_list[i]);
+    for (int i = 0; i < 4096; i++) {
+        increment[i] = rng_range(&rng, 1, max_increment);
     }
 
-    while (event_count > 0 && completed_process_count < PROCESS_COUNT) {
-        Event_Heap e = pop_event();
-        int now = e.time;
-        int to_io; // IO request  ð
-        int run; // CPU ۾  ð
-
-        // gantt chart 
-        for (int t = last_event_time; t < now && t < MAX_TIME; t++) {
-            if (executing_process) {
-                gantt[t] = executing_process->pid;
-            }
-            else {
-                gantt[t] = 0;
-            }
+    Arena arena;
+    arena_init(&arena, 0);
 
-            gantt_io[t] = 0;
-        }
+    Event_Queue q;
+    event_queue_init(&q, type, &arena);
 
-        last_event_time = now;
+    for (int i = 0; i < size; i++) {
+        event_queue_push(&q, rng_range(&rng, 0, max_increment * 2 - 1), 1, 0);
+    }
 
-        do {
-            Process* p = e.p;
+    clock_t start = clock();
 
-            // 1. Process Arrival
-            if (e.type == 1) {
-                enqueue(&ready_queue, p);
-            }
-            // 2. CPU Complete
-            else if (e.type == 2) {
-                // ̹ preemption Ǿ  ̻   ƴ 
-                if (p != executing_process) {
-                    break;
-                }
+    for (int i = 0; i < operations; i++) {
+        Event_Node e = event_queue_pop(&q);
+        event_queue_push(&q, (int)(e.key >> 32) + increment[i & 4095], 1, e.index);
+    }
 
-                //  ֱٿ  cpu ۾ ð
-                p->executed_time += now - last_run_start;
-                p->remaining_cpu -= now - last_run_start;
+    clock_t end = clock();
 
-                // I/O request ߻ 
-                if (p->executed_time == p->io_request_time) {
-                    if (now - 1 >= 0 && now - 1 < MAX_TIME) {
-                        gantt_io[now - 1] = p->pid;
-                    }
+    arena_free(&arena);
 
-                    p->remaining_io = p->io_burst;
-                    enqueue(&waiting_queue, p);
-                    // (now) +  io burst Ŀ Ǵ process push
-                    push_event(now + p->remaining_io, 3, p);
-                }
-                // preemption ߻ 
-                else if (p->remaining_cpu > 0) {
-                    enqueue(&ready_queue, p);
-                }
-                //   process
-                else {
-                    p->completion_time = now;
-                    completed_process_count++;
-                }
+    return (double)(end - start) / CLOCKS_PER_SEC * 1e9 / operations;
+}
 
-                executing_process = NULL;
-            }
-            // 3. IO Complete
-            else if (e.type == 3) {
-                p->remaining_io = 0;
-                dequeue_from_waiting_queue(&waiting_queue, p);
-                enqueue(&ready_queue, p);
-            }
+void benchmark_event_queue() {
+    int sizes[] = { 10, 100, 1000, 10000, 100000, 1000000 };
+    int size_count = sizeof(sizes) / sizeof(sizes[0]);
+    int max_increments[] = { 10, 100, 1000 }; // ª burst  ~  burst 
+    int increment_count = sizeof(max_increments) / sizeof(max_increments[0]);
+    int operations = 2000000;
 
-            // (now) ߻ϴ event    ó
-            if (event_count > 0 && event_heap[1].time == now) {
-                e = pop_event();
-            }
-            else {
-                break;
-            }
-        } while (1);
+    printf("\nEvent queue benchmark (hold model, ns per pop + push)\n");
 
-        // cpu Ҵ
-        if (!executing_process && !is_empty(&ready_queue)) {
-            executing_process = dequeue(&ready_queue);
+    for (int k = 0; k < increment_count; k++) {
+        int crossover = -1; //  ũ ̻󿡼 ׻ wheel 
 
-            // ó  process
-            if (executing_process->start_time < 0) {
-                executing_process->start_time = now;
-            }
+        printf("\nIncrement 1 ~ %d\n", max_increments[k]);
+        printf("%10s  %10s  %10s  %8s\n", "Events", "Heap", "Wheel", "Faster");
 
-            to_io = executing_process->io_request_time - executing_process->executed_time;
+        for (int i = 0; i < size_count; i++) {
+            double heap_ns = benchmark_hold(EVENT_QUEUE_HEAP, sizes[i], max_increments[k], operations, i + 1);
+            double wheel_ns = benchmark_hold(EVENT_QUEUE_WHEEL, sizes[i], max_increments[k], operations, i + 1);
 
-            // process IO ۾  ٽ CPU ۾ ϴ 
-            if (to_io <= 0) {
-                // TIME QUANTUMŭ ,   cpu burst    cpu burstŭ 
-                run = TIME_QUANTUM;
+            printf("%10d  %10.1f  %10.1f  %8s\n", sizes[i], heap_ns, wheel_ns, wheel_ns < heap_ns ? "wheel" : "heap");
 
-                if (executing_process->remaining_cpu < run) {
-                    run = executing_process->remaining_cpu;
+            if (wheel_ns < heap_ns) {
+                if (crossover < 0) {
+                    crossover = sizes[i];
                 }
             }
-            // IO request TIME QUANTUM  ߻ 
-            else if (to_io < TIME_QUANTUM) {
-                run = to_io;
-            }
-            // process IO ۾    , TIME QUANTUMŭ ,   cpu burst    cpu burstŭ 
             else {
-                run = TIME_QUANTUM;
-
-                if (executing_process->remaining_cpu < run) {
-                    run = executing_process->remaining_cpu;
-                }
+                crossover = -1;
             }
+        }
 
-            // process ؾ ϴ ۾  
-            if (run > 0) {
-                last_run_start = now;
-                push_event(now + run, 2, executing_process);
-            }
-            // process  ϴ 
-            else {
-                executing_process->completion_time = now;
-                completed_process_count++;
-                executing_process = NULL;
-            }
+        if (crossover < 0) {
+            printf("Crossover: heap is faster at the largest size\n");
+        }
+        else {
+            printf("Crossover: wheel is faster from %d events\n", crossover);
         }
     }
+}
 
-    gantt_end = last_event_time;
+// ˰򸶴   ϰ simulator ó ӵ JSON  ٷ  (bench.sh )
+// events event queue pop event , dispatches process CPU  Ҵ Ƚ (main2 ϴ )
+// allocations ش run  heap Ҵ Ƚ
+void benchmark_json(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch) {
+    SimContext ctx;
+    sim_init(&ctx, spec->process_count, event_queue_type);
+    ctx.time_quantum = time_quantum;
+    ctx.context_switch = context_switch;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        Process* p = &process_list[i];
-        p->turnaround_time = p->completion_time - p->arrival_time;
-        p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
-    }
-}
+    Rng rng;
+    rng_seed(&rng, seed);
+    create_process(&ctx, &rng, spec);
 
-void print_gantt() {
-    int width = 10;
+    // ū workload gantt chart ޸𸮸  ʵ  
+    ctx.gantt.record = false;
 
-    printf("\nGantt Chart:\nTime :");
+    printf("{\"engine\":\"event\",\"event_queue\":\"%s\",\"processes\":%d", event_queue_type == EVENT_QUEUE_WHEEL ? "wheel" : "heap",
+        spec->process_count);
 
-    for (int t = 0; t <= gantt_end; t++) {
-        printf("%*d", width, t);
+    // workload ̸ seed ǹ̰ Ƿ  
+    if (!spec->records) {
+        printf(",\"seed\":%llu", (unsigned long long)seed);
     }
-    printf("\n ");
 
-    for (int t = 0; t <= gantt_end; t++) {
-        for (int i = 0; i < width; i++) {
-            printf("-");
-        }
-    }
+    printf(",\"policies\":[");
 
-    printf("\nPID  :");
-    for (int t = 0; t <= gantt_end; t++) {
-        // Idle 
-        if (gantt[t] == 0) {
-            printf("|%*s", width - 1, "Idle");
-        }
-        // I/O request Ǳ  
-        else if (gantt_io[t]) {
-            char buffer[width + 1];
-            snprintf(buffer, sizeof(buffer), "P%d(I/O)", gantt[t]);
-            printf("| %*s", width - 2, buffer);
-        }
-        //   process
-        else {
-            char buffer[width + 1];
-            snprintf(buffer, sizeof(buffer), "P%d", gantt[t]);
-            printf("| %*s", width - 2, buffer);
-        }
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        struct timespec start, end;
+        long long allocations = allocation_count;
+
+        initialization(&ctx);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        schedulers[k].run(&ctx);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = elapsed_seconds(start, end);
+        double events = ctx.events.popped;
+        double decisions = ctx.metrics.dispatches;
+
+        printf("%s{\"policy\":\"%s\",\"events\":%.0f,\"dispatches\":%.0f,\"simulated_time\":%d,\"seconds\":%.6f,\"events_per_sec\":%.0f,\"ns_per_event\":%.2f,"
+            "\"dispatches_per_sec\":%.0f,\"ns_per_dispatch\":%.2f,\"allocations\":%lld", k > 0 ? "," : "", schedulers[k].name, events, decisions,
+            ctx.metrics.end_time, seconds, seconds > 0 ? events / seconds : 0, events > 0 ? seconds * 1e9 / events : 0, seconds > 0 ? decisions / seconds : 0,
+            decisions > 0 ? seconds * 1e9 / decisions : 0, allocation_count - allocations);
+        SIM_STAT(print_stats_json(&ctx));
+        printf("}");
     }
 
-    printf("|\n");
+    printf("],\"allocations\":%lld,\"peak_rss_kb\":%ld}\n", allocation_count, peak_rss_kb());
+
+    sim_free(&ctx);
 }
 
-void evaluation() {
-    int total_waiting_time = 0;
-    int total_turnaround_time = 0;
+// ˰򸶴 process , Ϸ     پ  (compare_engines.sh main2 --dump )
+//   I/O ǥÿ   process    ļ 
+void dump_schedules(const Workload_Spec* spec, uint64_t seed, Event_Queue_Type event_queue_type, int time_quantum, int context_switch) {
+    SimContext ctx;
+    sim_init(&ctx, spec->process_count, event_queue_type);
+    ctx.time_quantum = time_quantum;
+    ctx.context_switch = context_switch;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
-        total_waiting_time += process_list[i].waiting_time;
-        total_turnaround_time += process_list[i].turnaround_time;
-    }
+    Rng rng;
+    rng_seed(&rng, seed);
+    create_process(&ctx, &rng, spec);
 
-    double average_waiting_time = (double)total_waiting_time / PROCESS_COUNT;
-    double average_turnaround_time = (double)total_turnaround_time / PROCESS_COUNT;
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        initialization(&ctx);
+        schedulers[k].run(&ctx);
 
-    printf("\nEvaluation: Average waiting time = %.2f, Average turnaround time = %.2f\n", average_waiting_time, average_turnaround_time);
+        printf("policy %s\n", schedulers[k].name);
+
+        for (int i = 0; i < ctx.process_count; i++) {
+            printf("process %d %d %d\n", ctx.process_list[i].pid, ctx.table.start_time[i], ctx.table.completion_time[i]);
+        }
+
+        int j = 0;
+
+        while (j < ctx.gantt.count) {
+            Gantt_Interval* g = &ctx.gantt.interval[j++];
+            int end = g->end;
+
+            while (j < ctx.gantt.count && ctx.gantt.interval[j].pid == g->pid && ctx.gantt.interval[j].start == end) {
+                end = ctx.gantt.interval[j++].end;
+            }
+
+            printf("run %d %d %d\n", g->start, end, g->pid);
+        }
+    }
+
+    sim_free(&ctx);
 }
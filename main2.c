@@ -1,16 +1,86 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
 #include <time.h>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
-#define PROCESS_COUNT 5
-#define QUEUE_SIZE (PROCESS_COUNT + 1)
-#define MAX_TIME 100
-#define TIME_QUANTUM 3
+#if defined(SIM_STATS) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
 
 
+#define DEFAULT_PROCESS_COUNT 5
+#define DEFAULT_TIME_QUANTUM 3
+
+
+// malloc, realloc ȣ Ƚ (--bench )
+long long allocation_count = 0;
+
+// Ҵ Ƚ  malloc, realloc (ϸ NULL ״ ȯ)
+void* xmalloc(size_t size) {
+    allocation_count++;
+    return malloc(size);
+}
+
+void* xrealloc(void* p, size_t size) {
+    allocation_count++;
+    return realloc(p, size);
+}
+
+// ݱ  ִ  ޸ (KB,    0)
+long peak_rss_kb() {
+#ifndef _WIN32
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_maxrss;
+    }
+#endif
+
+    return 0;
+}
+
+
+// hot path : -DSIM_STATS compileϸ run Ƚ cycle  evaluation, --bench 
+// ⺻ build SIM_STAT(...)    ŵǹǷ  
+#ifdef SIM_STATS
+#define SIM_STAT(statement) statement
+
+// cycle counter (x86 ܿ ns)
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000 + (uint64_t)t.tv_nsec;
+#endif
+}
+
 typedef struct {
+    long long skipped_ticks; // skip_ahead   ѱ tick  (  tick ó)
+    long long queue_expansions; // expand_queue
+    long long ready_scans; // SJF, Priority ready queue  Ž Ƚ
+    long long ready_scan_length; // Žϸ鼭 캻 process  
+    long long preemptions; //  tick ϴ process  ٸ process  (Preemptive SJF, Priority)
+    long long context_switches; //  ٸ process 
+    uint64_t dispatch_cycles; //  process 
+    uint64_t timeline_cycles; // gantt chart 
+} Sim_Stats;
+
+Sim_Stats stats;
+#else
+#define SIM_STAT(statement)
+#endif
+
+
+typedef struct Process {
     int pid;
     int priority;
     int arrival_time;
@@ -24,6 +94,7 @@ typedef struct {
     int remaining_cpu;
     int remaining_io;
     int executed_time;
+    struct Process* io_next; //   I/O   process
 } Process;
 
 typedef struct {
@@ -33,9 +104,14 @@ typedef struct {
     int count;
 } Process_Queue;
 
+// ̹ buffer   ʰ    ( initialization ٽ Ҵ )
 void init(Process_Queue* q, int initial_capacity) {
-    q->process = malloc(sizeof(Process*) * initial_capacity);
-    q->capacity = initial_capacity;
+    if (!q->process || q->capacity < initial_capacity) {
+        free(q->process);
+        q->process = xmalloc(sizeof(Process*) * initial_capacity);
+        q->capacity = initial_capacity;
+    }
+
     q->front = 0;
     q->rear = 0;
     q->count = 0;
@@ -52,7 +128,9 @@ bool is_full(Process_Queue* q) {
 void expand_queue(Process_Queue* q) {
     int previous_capacity = q->capacity;
     int new_capacity = previous_capacity * 2;
-    Process** new_process = malloc(sizeof(Process*) * new_capacity);
+    Process** new_process = xmalloc(sizeof(Process*) * new_capacity);
+
+    SIM_STAT(stats.queue_expansions++);
 
     int length = (previous_capacity + q->rear - q->front) % previous_capacity;
 
@@ -93,16 +171,233 @@ Process* dequeue(Process_Queue* q) {
 
 
 Process_Queue ready_queue;
-Process_Queue waiting_queue;
 
-Process process_list[PROCESS_COUNT];
+// I/O Ϸ timer
+// I/O  process Ϸ (ready queue ư ) bucket   ־ ΰ,
+//  tick   bucket ó. bucket    I/O burst ũ    Ϸ  ġ ʰ 
+//    bucket Ϸ  min-heap ־ ξ skip_ahead  Ϸ  bucket  ʰ ã
+typedef struct {
+    Process** head;
+    Process** tail;
+    int* deadline; // Ϸ  min-heap (   bucket ϳ)
+    int deadline_count;
+    int size; // 2 ŵ
+    int count; // I/O  process 
+} IO_Timer;
+
+IO_Timer io_timer;
+
+void io_timer_init(IO_Timer* t, int max_io_burst) {
+    int size = 2;
+
+    while (size <= max_io_burst) {
+        size *= 2;
+    }
+
+    if (!t->head || t->size < size) {
+        free(t->head);
+        free(t->tail);
+        free(t->deadline);
+        t->head = xmalloc(sizeof(Process*) * size);
+        t->tail = xmalloc(sizeof(Process*) * size);
+        t->deadline = xmalloc(sizeof(int) * size);
+
+        if (!t->head || !t->tail || !t->deadline) {
+            fprintf(stderr, "io timer: out of memory (%d buckets)\n", size);
+            exit(1);
+        }
+    }
+
+    t->size = size;
+    t->count = 0;
+    t->deadline_count = 0;
+
+    for (int i = 0; i < size; i++) {
+        t->head[i] = NULL;
+    }
+}
+
+// Ϸ  heap time ߰
+void io_timer_push_deadline(IO_Timer* t, int time) {
+    int i = t->deadline_count++;
+
+    while (i > 0 && t->deadline[(i - 1) / 2] > time) {
+        t->deadline[i] = t->deadline[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+
+    t->deadline[i] = time;
+}
+
+// Ϸ  heap  ̸  
+void io_timer_pop_deadline(IO_Timer* t) {
+    int last = t->deadline[--t->deadline_count];
+    int i = 0;
+
+    while (2 * i + 1 < t->deadline_count) {
+        int child = 2 * i + 1;
+
+        if (child + 1 < t->deadline_count && t->deadline[child + 1] < t->deadline[child]) {
+            child++;
+        }
+
+        if (t->deadline[child] >= last) {
+            break;
+        }
+
+        t->deadline[i] = t->deadline[child];
+        i = child;
+    }
+
+    t->deadline[i] = last;
+}
+
+// time  tick  I/O request  process ߰
+// I/O  tick I/O burst  ǰ   ready queue ư (main.c )
+void io_timer_add(IO_Timer* t, Process* p, int time) {
+    int done = time + 1 + p->io_burst;
+    int slot = done & (t->size - 1);
+
+    p->remaining_io = p->io_burst;
+    p->io_next = NULL;
 
-int gantt[MAX_TIME];
-int gantt_io[MAX_TIME];
+    if (t->head[slot]) {
+        t->tail[slot]->io_next = p;
+    }
+    else {
+        t->head[slot] = p;
+        io_timer_push_deadline(t, done);
+    }
+
+    t->tail[slot] = p;
+    t->count++;
+}
+
+// time  I/O  process ready queue push
+void io_timer_expire(IO_Timer* t, int time) {
+    int slot = time & (t->size - 1);
+    Process* p = t->head[slot];
+
+    if (!p) {
+        return;
+    }
+
+    t->head[slot] = NULL;
+    io_timer_pop_deadline(t);
+
+    while (p) {
+        Process* next = p->io_next;
+
+        p->remaining_io = 0;
+        enqueue(&ready_queue, p);
+        t->count--;
+        p = next;
+    }
+}
+
+//   I/O   (I/O  process  INT_MAX)
+// skip_ahead Ϸ   tick ǳʶٹǷ heap time    
+int io_timer_next(IO_Timer* t) {
+    if (t->deadline_count == 0) {
+        return INT_MAX;
+    }
+
+    return t->deadline[0];
+}
+
+Process* process_list = NULL;
+int process_count = DEFAULT_PROCESS_COUNT;
+Process** arrival_order = NULL; //  ð   process (  process_list , main.c  event pushϴ  )
+int arrival_cursor = 0; //    ù process
+int time_quantum = DEFAULT_TIME_QUANTUM; // Round Robin
+
+// gantt chart process      (ϵ  ð Idle)
+typedef struct {
+    int start; //   
+    int end; //    (end  )
+    int pid;
+    bool io; //    I/O request ߻
+} Gantt_Interval;
+
+Gantt_Interval* gantt = NULL;
+int gantt_count = 0;
+int gantt_capacity = 0;
 int gantt_end = 0;
 
+//   ϴ run ü ǥ (gantt chart  )
+long long busy_time = 0; // process CPU  ð
+long long response_sum = 0; //  ó CPU Ҵ  ð 
+long long dispatches = 0; // ready queue process  CPU Ҵ Ƚ ( tick ϴ process ٽ   )
+
+// [start, end)  pid   ,   ̾ ħ
+void gantt_record(int start, int end, int pid) {
+    if (start >= end || pid == 0) {
+        return;
+    }
+
+    SIM_STAT(stats.context_switches += gantt_count == 0 || gantt[gantt_count - 1].pid != pid);
+
+    if (gantt_count > 0) {
+        Gantt_Interval* last = &gantt[gantt_count - 1];
+
+        if (last->pid == pid && last->end == start && !last->io) {
+            last->end = end;
+            return;
+        }
+    }
+
+    if (gantt_count == gantt_capacity) {
+        int new_capacity = gantt_capacity ? gantt_capacity * 2 : 64;
+        Gantt_Interval* new_gantt = xrealloc(gantt, sizeof(Gantt_Interval) * new_capacity);
+
+        if (!new_gantt) {
+            fprintf(stderr, "gantt chart: out of memory (%d intervals)\n", new_capacity);
+            exit(1);
+        }
+
+        gantt = new_gantt;
+        gantt_capacity = new_capacity;
+    }
+
+    gantt[gantt_count].start = start;
+    gantt[gantt_count].end = end;
+    gantt[gantt_count].pid = pid;
+    gantt[gantt_count].io = false;
+    gantt_count++;
+}
+
+// time   pid  I/O request ǥ
+void gantt_mark_io(int time, int pid) {
+    if (gantt_count > 0 && gantt[gantt_count - 1].end == time && gantt[gantt_count - 1].pid == pid) {
+        gantt[gantt_count - 1].io = true;
+    }
+}
+
+
+// main.c binary workload : header ڿ process record ƴ ̾ (little-endian)
+#define WORKLOAD_MAGIC "SCHEDWL1"
+#define MAX_ARRIVAL_TIME 2000000001 // main.c   (  burst  int  )
+#define MAX_BURST 10000
+
+typedef struct {
+    char magic[8];
+    uint32_t record_size; // sizeof(Workload_Record)
+    uint32_t reserved;
+    uint64_t process_count;
+} Workload_Header;
+
+typedef struct {
+    int32_t pid;
+    int32_t priority;
+    int32_t arrival_time;
+    int32_t cpu_burst;
+    int32_t io_burst;
+    int32_t io_request_time;
+} Workload_Record;
+
 
 void create_process();
+void build_arrival_order();
 void print_process_list();
 void initialization();
 void scheduling_FCFS();
@@ -113,60 +408,173 @@ void scheduling_Preemptive_Priority();
 void scheduling_Round_Robin();
 void print_gantt();
 void evaluation();
+#ifdef SIM_STATS
+void print_stats();
+void print_stats_json();
+#endif
+void print_usage(const char* program);
+void benchmark_json(unsigned int seed, bool seeded);
+void dump_schedules();
+void run_serial(bool quiet);
+bool load_workload(const char* path);
+
+//  scheduling ˰ ( )
+const char* scheduler_name[] = { "FCFS", "Non-Preemptive SJF", "Preemptive SJF", "Non-Preemptive Priority", "Preemptive Priority", "Round Robin" };
+void (*scheduler_run[])() = { scheduling_FCFS, scheduling_Non_Preemptive_SJF, scheduling_Preemptive_SJF,
+    scheduling_Non_Preemptive_Priority, scheduling_Preemptive_Priority, scheduling_Round_Robin };
+
+#define SCHEDULER_COUNT (int)(sizeof(scheduler_run) / sizeof(scheduler_run[0]))
+
+
+int main(int argc, char* argv[]) {
+    bool quiet = false;
+    bool bench = false;
+    bool dump = false;
+    const char* workload_path = NULL;
+    unsigned int seed = (unsigned int)time(NULL);
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            process_count = atoi(argv[++i]);
+
+            if (process_count <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-q") == 0) {
+            quiet = true;
+        }
+        // workload seed
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        }
+        // main.c binary workload 
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            workload_path = argv[++i];
+        }
+        // simulator ó ӵ (JSON)
+        else if (strcmp(argv[i], "--bench") == 0) {
+            bench = true;
+        }
+        // process , Ϸ    (compare_engines.sh)
+        else if (strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        }
+        // Round Robin time quantum
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            time_quantum = atoi(argv[++i]);
+
+            if (time_quantum <= 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (workload_path) {
+        if (!load_workload(workload_path)) {
+            return 1;
+        }
+    }
+    else {
+        process_list = xmalloc(sizeof(Process) * process_count);
+
+        if (!process_list) {
+            fprintf(stderr, "process list: out of memory (%d processes)\n", process_count);
+            return 1;
+        }
+
+        srand(seed);
+
+        create_process();
+    }
+
+    build_arrival_order();
 
+    if (bench) {
+        benchmark_json(seed, workload_path == NULL);
+    }
+    else if (dump) {
+        dump_schedules();
+    }
+    else {
+        run_serial(quiet);
+    }
 
-int main(void) {
-    srand(time(NULL));
+    free(ready_queue.process);
+    free(io_timer.head);
+    free(io_timer.tail);
+    free(io_timer.deadline);
+    free(gantt);
+    free(arrival_order);
+    free(process_list);
 
-    create_process();
+    return 0;
+}
 
-    print_process_list();
+//  ˰ ʷ ϰ gantt chart,  
+void run_serial(bool quiet) {
+    if (!quiet) {
+        print_process_list();
+    }
 
     initialization();
     printf("\nFCFS Scheduling\n");
     scheduling_FCFS();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
 
     initialization();
     printf("\nNon-Preemptive SJF Scheduling\n");
     scheduling_Non_Preemptive_SJF();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
 
     initialization();
     printf("\nPreemptive SJF Scheduling\n");
     scheduling_Preemptive_SJF();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
 
     initialization();
     printf("\nNon-Preemptive Priority Scheduling\n");
     scheduling_Non_Preemptive_Priority();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
 
     initialization();
     printf("\nPreemptive Priority Scheduling\n");
     scheduling_Preemptive_Priority();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
 
     initialization();
     printf("\nRound Robin Scheduling\n");
     scheduling_Round_Robin();
-    print_gantt();
+    if (!quiet) {
+        print_gantt();
+    }
     evaluation();
-
-    free(ready_queue.process);
-    free(waiting_queue.process);
-
-    return 0;
 }
 
 
 void create_process() {
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         p->pid = i + 1;
@@ -189,7 +597,7 @@ void print_process_list() {
     printf("\nProcess List:\n");
     printf("PID  Priority  Arrival  CPU_Burst  IO_Request  IO_Burst\n");
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         printf("%3d  %8d  %7d  %9d  %10d  %8d\n", p->pid, p->priority, p->arrival_time, p->cpu_burst, p->io_request_time, p->io_burst);
@@ -197,18 +605,28 @@ void print_process_list() {
 }
 
 void initialization() {
-    init(&ready_queue, QUEUE_SIZE);
-    init(&waiting_queue, QUEUE_SIZE);
-
-    for (int i = 0; i < MAX_TIME; i++) {
-        gantt[i] = 0;
-        gantt_io[i] = 0;
-    }
+    init(&ready_queue, process_count + 1);
 
+    gantt_count = 0;
     gantt_end = 0;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    busy_time = 0;
+    response_sum = 0;
+    dispatches = 0;
+
+    arrival_cursor = 0;
+
+    SIM_STAT(memset(&stats, 0, sizeof(stats)));
+
+    int max_io_burst = 0;
+
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
+
+        if (p->io_burst > max_io_burst) {
+            max_io_burst = p->io_burst;
+        }
+
         p->remaining_cpu = p->cpu_burst;
         p->remaining_io = 0;
         p->executed_time = 0;
@@ -217,6 +635,121 @@ void initialization() {
         p->waiting_time = 0;
         p->turnaround_time = 0;
     }
+
+    io_timer_init(&io_timer, max_io_burst);
+}
+
+//  ð   (  process_list )
+int compare_arrival(const void* a, const void* b) {
+    const Process* p = *(Process* const*)a;
+    const Process* q = *(Process* const*)b;
+
+    if (p->arrival_time != q->arrival_time) {
+        return p->arrival_time < q->arrival_time ? -1 : 1;
+    }
+
+    return p < q ? -1 : (p > q ? 1 : 0);
+}
+
+//  tick ü process ˻ ʵ   ̸ 
+void build_arrival_order() {
+    arrival_order = xmalloc(sizeof(Process*) * process_count);
+
+    if (!arrival_order) {
+        fprintf(stderr, "arrival order: out of memory (%d processes)\n", process_count);
+        exit(1);
+    }
+
+    for (int i = 0; i < process_count; i++) {
+        arrival_order[i] = &process_list[i];
+    }
+
+    qsort(arrival_order, process_count, sizeof(Process*), compare_arrival);
+}
+
+// time   process ready queue push
+void admit_arrivals(int time) {
+    while (arrival_cursor < process_count && arrival_order[arrival_cursor]->arrival_time <= time) {
+        enqueue(&ready_queue, arrival_order[arrival_cursor++]);
+    }
+}
+
+// time ƹ ϵ Ͼ ʴ tick ִ limit   ϰ  tick  ȯ
+// ƹ ϵ  tick: , I/O Ϸᰡ  running I/O request     (running NULL̸ CPU idle)
+int skip_ahead(int time, Process* running, int limit) {
+    int ticks = limit;
+
+    // tick     I/O ϷḦ óϹǷ , Ϸ   tick 
+    // ( tick ϴ process  ready queue  )
+    if (arrival_cursor < process_count && arrival_order[arrival_cursor]->arrival_time - time - 1 < ticks) {
+        ticks = arrival_order[arrival_cursor]->arrival_time - time - 1;
+    }
+
+    int next_io = io_timer_next(&io_timer);
+
+    if (next_io != INT_MAX && next_io - time - 1 < ticks) {
+        ticks = next_io - time - 1;
+    }
+
+    if (running) {
+        if (running->executed_time < running->io_request_time && running->io_request_time - running->executed_time - 1 < ticks) {
+            ticks = running->io_request_time - running->executed_time - 1;
+        }
+
+        if (running->remaining_cpu - 1 < ticks) {
+            ticks = running->remaining_cpu - 1;
+        }
+    }
+
+    //  ̻ Ͼ    ( process )
+    if (ticks <= 0 || ticks == INT_MAX) {
+        return 0;
+    }
+
+    if (running) {
+        running->executed_time += ticks;
+        running->remaining_cpu -= ticks;
+        busy_time += ticks;
+        gantt_record(time, time + ticks, running->pid);
+    }
+
+    SIM_STAT(stats.skipped_ticks += ticks);
+    return ticks;
+}
+
+// ready queue   process   process remaining_cpu   tick ٽ õ
+// (   process  tick ϴ process  õǹǷ ,    process start_time   )
+bool rear_is_shortest() {
+    Process* rear = ready_queue.process[(ready_queue.rear + ready_queue.capacity - 1) % ready_queue.capacity];
+
+    if (rear->start_time < 0) {
+        return false;
+    }
+
+    for (int k = 0; k < ready_queue.count - 1; k++) {
+        if (ready_queue.process[(ready_queue.front + k) % ready_queue.capacity]->remaining_cpu <= rear->remaining_cpu) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ready queue   process   process priority   tick ٽ õ
+bool rear_is_highest_priority() {
+    Process* rear = ready_queue.process[(ready_queue.rear + ready_queue.capacity - 1) % ready_queue.capacity];
+
+    if (rear->start_time < 0) {
+        return false;
+    }
+
+    for (int k = 0; k < ready_queue.count - 1; k++) {
+        if (ready_queue.process[(ready_queue.front + k) % ready_queue.capacity]->priority >= rear->priority) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 // FCFS ٸ ˰
@@ -226,26 +759,25 @@ void scheduling_FCFS() {
     Process* executing_process = NULL;
     bool idle = true;
     
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
         // Process   ready queue push
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
         //   process  
         if (!executing_process) {
             executing_process = dequeue(&ready_queue);
             
             if (executing_process) {
+                dispatches++;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 idle = false;
@@ -255,18 +787,19 @@ void scheduling_FCFS() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         // CPU ۾ ó
         if (executing_process) {
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
 
             // IO ߻  waiting queue push
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
             }
             // CPU ۾  
@@ -279,37 +812,38 @@ void scheduling_FCFS() {
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        // IO ۾ ó
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                p->remaining_io--;
+        SIM_STAT(uint64_t timeline_start = read_cycles());
 
-                // IO burst  waiting queue push
-                if (p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                // IO ۾   ready queue push
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
+        gantt_record(time, time + 1, tick_pid);
 
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
         }
 
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
         time++;
+
+        //  , I/O Ϸ, I/O request,   tick   ó
+        if (executing_process || is_empty(&ready_queue)) {
+            time += skip_ahead(time, executing_process, INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
         p->turnaround_time = p->completion_time - p->arrival_time;
         p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
@@ -323,23 +857,21 @@ void scheduling_Non_Preemptive_SJF() {
     Process* executing_process = NULL;
     bool idle = true;
 
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
         if (!executing_process) {
             if (!is_empty(&ready_queue)) {
                 int shortest_index = ready_queue.front;
                 int shortest_cpu_burst = ready_queue.process[shortest_index]->remaining_cpu;
                 
+                SIM_STAT(stats.ready_scans++; stats.ready_scan_length += ready_queue.count);
+
                 for (int k = 0; k < ready_queue.count; k++) {
                     int idx = (ready_queue.front + k) % ready_queue.capacity;
                     Process* p = ready_queue.process[idx];
@@ -369,8 +901,11 @@ void scheduling_Non_Preemptive_SJF() {
 
                 ready_queue.count--;
 
+                dispatches++;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 idle = false;
@@ -380,16 +915,17 @@ void scheduling_Non_Preemptive_SJF() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         if (executing_process) {
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
 
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
             }
             else if (executing_process->remaining_cpu == 0) {
@@ -401,31 +937,38 @@ void scheduling_Non_Preemptive_SJF() {
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                if (--p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
+        SIM_STAT(uint64_t timeline_start = read_cycles());
+
+        gantt_record(time, time + 1, tick_pid);
+
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
         }
 
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
         time++;
+
+        //  , I/O Ϸ, I/O request,   tick   ó
+        if (executing_process || is_empty(&ready_queue)) {
+            time += skip_ahead(time, executing_process, INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
         p->turnaround_time = p->completion_time - p->arrival_time;
         p->waiting_time = p->turnaround_time - p->cpu_burst - p->io_burst;
@@ -438,29 +981,28 @@ void scheduling_Preemptive_SJF() {
     int completed_process_count = 0;
     Process* executing_process = NULL;
     bool idle = true;
+    Process* previous = NULL; //  tick ϰ ready queue ư process ( cpu burst   )
 
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
         if (!executing_process) {
             if (!is_empty(&ready_queue)) {
                 int shortest_index = ready_queue.front;
                 int shortest_cpu_burst = ready_queue.process[shortest_index]->remaining_cpu;
 
+                SIM_STAT(stats.ready_scans++; stats.ready_scan_length += ready_queue.count);
+
                 for (int k = 0; k < ready_queue.count; k++) {
                     int idx = (ready_queue.front + k) % ready_queue.capacity;
                     Process* p = ready_queue.process[idx];
 
-                    if (p->remaining_cpu < shortest_cpu_burst) {
+                    if (p->remaining_cpu < shortest_cpu_burst || (p == previous && p->remaining_cpu == shortest_cpu_burst)) {
                         shortest_cpu_burst = p->remaining_cpu;
                         shortest_index = idx;
                     }
@@ -485,8 +1027,13 @@ void scheduling_Preemptive_SJF() {
 
                 ready_queue.count--;
 
+                dispatches += executing_process != previous;
+                SIM_STAT(stats.preemptions += previous && executing_process != previous);
+                previous = NULL;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 idle = false;
@@ -496,16 +1043,17 @@ void scheduling_Preemptive_SJF() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         if (executing_process) {
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
 
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
             }
             else if (executing_process->remaining_cpu == 0) {
@@ -515,37 +1063,52 @@ void scheduling_Preemptive_SJF() {
                 idle = false;
             }
             else {
-                enqueue(&ready_queue, executing_process);
+                previous = executing_process;
                 executing_process = NULL;
             }
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                if (--p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
+        SIM_STAT(uint64_t timeline_start = read_cycles());
+
+        gantt_record(time, time + 1, tick_pid);
+
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
+        }
+
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
+        // ϴ process  ڿ ready queue ư (main.c   event  ó  preemption ˻ϴ Ͱ )
+        if (previous) {
+            enqueue(&ready_queue, previous);
         }
 
         time++;
+
+        // ready queue   process  õǴ    ó
+        if (is_empty(&ready_queue)) {
+            time += skip_ahead(time, NULL, INT_MAX);
+        }
+        else if (rear_is_shortest()) {
+            time += skip_ahead(time, ready_queue.process[(ready_queue.rear + ready_queue.capacity - 1) % ready_queue.capacity], INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         p->turnaround_time = p->completion_time - p->arrival_time;
@@ -560,23 +1123,21 @@ void scheduling_Non_Preemptive_Priority() {
     Process* executing_process = NULL;
     bool idle = true;
 
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
         if (!executing_process) {
             if (!is_empty(&ready_queue)) {
                 int best_index = ready_queue.front;
                 int best_priority = ready_queue.process[best_index]->priority;
 
+                SIM_STAT(stats.ready_scans++; stats.ready_scan_length += ready_queue.count);
+
                 for (int k = 0; k < ready_queue.count; k++) {
                     int idx = (ready_queue.front + k) % ready_queue.capacity;
                     Process* p = ready_queue.process[idx];
@@ -606,8 +1167,11 @@ void scheduling_Non_Preemptive_Priority() {
 
                 ready_queue.count--;
 
+                dispatches++;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 idle = false;
@@ -617,16 +1181,17 @@ void scheduling_Non_Preemptive_Priority() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         if (executing_process) {
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
 
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
             }
             else if (executing_process->remaining_cpu == 0) {
@@ -638,31 +1203,38 @@ void scheduling_Non_Preemptive_Priority() {
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                if (--p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
+        SIM_STAT(uint64_t timeline_start = read_cycles());
+
+        gantt_record(time, time + 1, tick_pid);
+
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
         }
 
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
         time++;
+
+        //  , I/O Ϸ, I/O request,   tick   ó
+        if (executing_process || is_empty(&ready_queue)) {
+            time += skip_ahead(time, executing_process, INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         p->turnaround_time = p->completion_time - p->arrival_time;
@@ -676,29 +1248,28 @@ void scheduling_Preemptive_Priority() {
     int completed_process_count = 0;
     Process* executing_process = NULL;
     bool idle = true;
+    Process* previous = NULL; //  tick ϰ ready queue ư process (priority   )
 
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
         if (!executing_process) {
             if (!is_empty(&ready_queue)) {
                 int best_index = ready_queue.front;
                 int best_priority = ready_queue.process[best_index]->priority;
 
+                SIM_STAT(stats.ready_scans++; stats.ready_scan_length += ready_queue.count);
+
                 for (int k = 0; k < ready_queue.count; k++) {
                     int idx = (ready_queue.front + k) % ready_queue.capacity;
                     Process* p = ready_queue.process[idx];
 
-                    if (p->priority > best_priority) {
+                    if (p->priority > best_priority || (p == previous && p->priority == best_priority)) {
                         best_priority = p->priority;
                         best_index = idx;
                     }
@@ -723,8 +1294,13 @@ void scheduling_Preemptive_Priority() {
 
                 ready_queue.count--;
 
+                dispatches += executing_process != previous;
+                SIM_STAT(stats.preemptions += previous && executing_process != previous);
+                previous = NULL;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 idle = false;
@@ -734,16 +1310,17 @@ void scheduling_Preemptive_Priority() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         if (executing_process) {
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
 
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
             }
             else if (executing_process->remaining_cpu == 0) {
@@ -753,37 +1330,52 @@ void scheduling_Preemptive_Priority() {
                 idle = false;
             }
             else {
-                enqueue(&ready_queue, executing_process);
+                previous = executing_process;
                 executing_process = NULL;
             }
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                if (--p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
+        SIM_STAT(uint64_t timeline_start = read_cycles());
+
+        gantt_record(time, time + 1, tick_pid);
+
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
+        }
+
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
+        // ϴ process  ڿ ready queue ư (main.c   event  ó  preemption ˻ϴ Ͱ )
+        if (previous) {
+            enqueue(&ready_queue, previous);
         }
 
         time++;
+
+        // ready queue   process  õǴ    ó
+        if (is_empty(&ready_queue)) {
+            time += skip_ahead(time, NULL, INT_MAX);
+        }
+        else if (rear_is_highest_priority()) {
+            time += skip_ahead(time, ready_queue.process[(ready_queue.rear + ready_queue.capacity - 1) % ready_queue.capacity], INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         p->turnaround_time = p->completion_time - p->arrival_time;
@@ -799,19 +1391,15 @@ void scheduling_Round_Robin() {
     bool idle = true;
     int quantum_count = 0;
 
-    while (completed_process_count < PROCESS_COUNT && time < MAX_TIME) {
-        gantt[time] = 0;
-        gantt_io[time] = 0;
+    while (completed_process_count < process_count) {
+        int tick_pid = 0; // ̹   process
+        bool tick_io = false;
 
-        for (int i = 0; i < PROCESS_COUNT; i++) {
-            Process* p = &process_list[i];
+        admit_arrivals(time);
 
-            if (p->arrival_time == time) {
-                enqueue(&ready_queue, p);
-            }
-        }
+        SIM_STAT(uint64_t dispatch_start = read_cycles());
 
-        if (!executing_process || quantum_count == TIME_QUANTUM) {
+        if (!executing_process || quantum_count == time_quantum) {
             if (executing_process) {
                 enqueue(&ready_queue, executing_process);
                 executing_process = NULL;
@@ -820,8 +1408,11 @@ void scheduling_Round_Robin() {
             if (!is_empty(&ready_queue)) {
                 executing_process = dequeue(&ready_queue);
 
+                dispatches++;
+
                 if (executing_process->start_time < 0) {
                     executing_process->start_time = time;
+                    response_sum += time - executing_process->arrival_time;
                 }
 
                 quantum_count = 0;
@@ -832,17 +1423,18 @@ void scheduling_Round_Robin() {
             }
         }
 
+        SIM_STAT(stats.dispatch_cycles += read_cycles() - dispatch_start);
+
         if (executing_process) {
-            gantt[time] = executing_process->pid;
+            tick_pid = executing_process->pid;
             executing_process->executed_time++;
             executing_process->remaining_cpu--;
             quantum_count++;
 
             if (executing_process->executed_time == executing_process->io_request_time) {
-                executing_process->remaining_io = executing_process->io_burst;
-                enqueue(&waiting_queue, executing_process);
+                io_timer_add(&io_timer, executing_process, time);
                 executing_process = NULL;
-                gantt_io[time] = 1;
+                tick_io = true;
                 idle = false;
                 quantum_count = 0;
             }
@@ -856,32 +1448,44 @@ void scheduling_Round_Robin() {
         }
 
         if (idle) {
-            gantt[time] = 0;
+            tick_pid = 0;
         }
 
-        for (int i = 0; i < waiting_queue.count; i++) {
-            Process* p = dequeue(&waiting_queue);
+        if (tick_pid) {
+            busy_time++;
+        }
 
-            if (p) {
-                if (--p->remaining_io > 0) {
-                    enqueue(&waiting_queue, p);
-                }
-                else {
-                    enqueue(&ready_queue, p);
-                }
-            }
-            else {
-                break;
-            }
-            
+        SIM_STAT(uint64_t timeline_start = read_cycles());
+
+        gantt_record(time, time + 1, tick_pid);
+
+        if (tick_io) {
+            gantt_mark_io(time + 1, tick_pid);
         }
 
+        SIM_STAT(stats.timeline_cycles += read_cycles() - timeline_start);
+
+        //    process, I/O  process  ready queue push (main.c event ó  )
+        admit_arrivals(time + 1);
+        io_timer_expire(&io_timer, time + 1);
+
         time++;
+
+        // time quantum   ƹ ϵ  tick   ó
+        if (executing_process && quantum_count < time_quantum) {
+            int ticks = skip_ahead(time, executing_process, time_quantum - quantum_count);
+
+            time += ticks;
+            quantum_count += ticks;
+        }
+        else if (!executing_process && is_empty(&ready_queue)) {
+            time += skip_ahead(time, NULL, INT_MAX);
+        }
     }
 
     gantt_end = time;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         Process* p = &process_list[i];
 
         p->turnaround_time = p->completion_time - p->arrival_time;
@@ -904,18 +1508,24 @@ void print_gantt() {
         }
 
     printf("\nPID  :");
+        int k = 0;
+
         for (int t = 0; t <= gantt_end; t++) {
-            if (gantt[t] == 0) {
+            while (k < gantt_count && gantt[k].end <= t) {
+                k++;
+            }
+
+            if (k == gantt_count || gantt[k].start > t) {
                 printf("|%*s", width - 1, "Idle");
             }
-            else if (gantt_io[t]) {
+            else if (gantt[k].io && t == gantt[k].end - 1) {
                 char buffer[width + 1];
-                snprintf(buffer, sizeof(buffer), "P%d(I/O)", gantt[t]);
+                snprintf(buffer, sizeof(buffer), "P%d(I/O)", gantt[k].pid);
                 printf("| %*s", width - 2, buffer);
             }
             else {
                 char buffer[width + 1];
-                snprintf(buffer, sizeof(buffer), "P%d", gantt[t]);
+                snprintf(buffer, sizeof(buffer), "P%d", gantt[k].pid);
                 printf("| %*s", width - 2, buffer);
             }
         }
@@ -924,16 +1534,220 @@ void print_gantt() {
 }
 
 void evaluation() {
-    int total_waiting_time = 0;
-    int total_turnaround_time = 0;
+    long long total_waiting_time = 0;
+    long long total_turnaround_time = 0;
 
-    for (int i = 0; i < PROCESS_COUNT; i++) {
+    for (int i = 0; i < process_count; i++) {
         total_waiting_time += process_list[i].waiting_time;
         total_turnaround_time += process_list[i].turnaround_time;
     }
 
-    double average_waiting_time = (double)total_waiting_time / PROCESS_COUNT;
-    double average_turnaround_time = (double)total_turnaround_time / PROCESS_COUNT;
+    double average_waiting_time = (double)total_waiting_time / process_count;
+    double average_turnaround_time = (double)total_turnaround_time / process_count;
 
     printf("\nEvaluation: Average waiting time = %.2f, Average turnaround time = %.2f\n", average_waiting_time, average_turnaround_time);
+
+    double average_response_time = (double)response_sum / process_count;
+    double utilization = gantt_end > 0 ? (double)busy_time / gantt_end : 0;
+    double throughput = gantt_end > 0 ? (double)process_count / gantt_end : 0;
+
+    printf("            Average response time = %.2f, CPU utilization = %.2f%%, Idle time = %lld, Throughput = %.4f\n", average_response_time,
+        utilization * 100, gantt_end - busy_time, throughput);
+
+    SIM_STAT(print_stats());
+}
+
+#ifdef SIM_STATS
+// run ϳ hot path  
+void print_stats() {
+    printf("            Stats: ticks stepped/skipped = %lld/%lld, ready scans = %lld (%.1f processes each), preemptions = %lld, context switches = %lld\n",
+        gantt_end - stats.skipped_ticks, stats.skipped_ticks, stats.ready_scans, stats.ready_scans > 0 ? (double)stats.ready_scan_length / stats.ready_scans : 0,
+        stats.preemptions, stats.context_switches);
+    printf("                   queue expansions = %lld, cycles dispatch/timeline = %llu/%llu\n", stats.queue_expansions,
+        (unsigned long long)stats.dispatch_cycles, (unsigned long long)stats.timeline_cycles);
+}
+
+// --bench JSON policy ׸ ̴  
+void print_stats_json() {
+    printf(",\"stats\":{\"ticks_stepped\":%lld,\"ticks_skipped\":%lld,\"ready_scans\":%lld,\"ready_scan_steps\":%lld,\"preemptions\":%lld,",
+        gantt_end - stats.skipped_ticks, stats.skipped_ticks, stats.ready_scans, stats.ready_scan_length, stats.preemptions);
+    printf("\"context_switches\":%lld,\"queue_expansions\":%lld,\"dispatch_cycles\":%llu,\"timeline_cycles\":%llu}", stats.context_switches,
+        stats.queue_expansions, (unsigned long long)stats.dispatch_cycles, (unsigned long long)stats.timeline_cycles);
+}
+#endif
+
+void print_usage(const char* program) {
+    printf("Usage: %s [-n count] [-q] [-s seed] [-f file] [-t quantum] [--bench] [--dump]\n", program);
+    printf("  -n count   number of processes (default: %d)\n", DEFAULT_PROCESS_COUNT);
+    printf("  -q         do not print the process list and gantt charts\n");
+    printf("  -s seed    workload seed (default: current time)\n");
+    printf("  -f file    run a binary workload file (main --import-csv or --export-workload) instead of a random workload\n");
+    printf("  -t quantum Round Robin time quantum (default: %d)\n", DEFAULT_TIME_QUANTUM);
+    printf("  --bench    run every policy once and print dispatches/s, ns/dispatch, allocations and peak RSS\n");
+    printf("             as one line of JSON\n");
+    printf("  --dump     print each policy's per-process start/completion times and run intervals\n");
+    printf("             in the format of main --dump (see compare_engines.sh)\n");
+}
+
+// ˰򸶴   ϰ simulator ó ӵ JSON  ٷ  (bench.sh )
+// main.c ó   ֵ tick  ƴ dispatch  (process CPU  Ҵ Ƚ) 
+void benchmark_json(unsigned int seed, bool seeded) {
+    printf("{\"engine\":\"tick\",\"processes\":%d", process_count);
+
+    // workload ̸ seed ǹ̰ Ƿ  
+    if (seeded) {
+        printf(",\"seed\":%u", seed);
+    }
+
+    printf(",\"policies\":[");
+
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        struct timespec start, end;
+        long long allocations = allocation_count;
+
+        initialization();
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        scheduler_run[k]();
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+        double decisions = dispatches;
+
+        printf("%s{\"policy\":\"%s\",\"dispatches\":%.0f,\"simulated_time\":%d,\"seconds\":%.6f,\"dispatches_per_sec\":%.0f,\"ns_per_dispatch\":%.2f,\"allocations\":%lld",
+            k > 0 ? "," : "", scheduler_name[k], decisions, gantt_end, seconds, seconds > 0 ? decisions / seconds : 0,
+            decisions > 0 ? seconds * 1e9 / decisions : 0, allocation_count - allocations);
+        SIM_STAT(print_stats_json());
+        printf("}");
+    }
+
+    printf("],\"allocations\":%lld,\"peak_rss_kb\":%ld}\n", allocation_count, peak_rss_kb());
+}
+
+int compare_pid(const void* a, const void* b) {
+    int32_t x = *(const int32_t*)a;
+    int32_t y = *(const int32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+// pid 迭 ؼ   ̻  pid ã ( 0)
+int32_t find_duplicate_pid(int32_t* pid, int count) {
+    qsort(pid, count, sizeof(int32_t), compare_pid);
+
+    for (int i = 1; i < count; i++) {
+        if (pid[i] == pid[i - 1]) {
+            return pid[i];
+        }
+    }
+
+    return 0;
+}
+
+// workload  о process_list , ϸ false
+// record  main.c  (io request cpu burst  1)
+bool load_workload(const char* path) {
+    FILE* file = fopen(path, "rb");
+
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    Workload_Header header;
+
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, WORKLOAD_MAGIC, 8) != 0 || header.record_size != sizeof(Workload_Record)) {
+        fprintf(stderr, "%s: not a workload file\n", path);
+        fclose(file);
+        return false;
+    }
+
+    if (header.process_count == 0 || header.process_count > INT_MAX) {
+        fprintf(stderr, "%s: bad process count %llu\n", path, (unsigned long long)header.process_count);
+        fclose(file);
+        return false;
+    }
+
+    process_count = (int)header.process_count;
+    process_list = xmalloc(sizeof(Process) * process_count);
+
+    // --dump gantt chart pid process ϹǷ ġ  
+    int32_t* pid = xmalloc(sizeof(int32_t) * process_count);
+
+    if (!process_list || !pid) {
+        fprintf(stderr, "process list: out of memory (%d processes)\n", process_count);
+        free(pid);
+        fclose(file);
+        return false;
+    }
+
+    for (int i = 0; i < process_count; i++) {
+        Workload_Record r;
+        Process* p = &process_list[i];
+
+        if (fread(&r, sizeof(r), 1, file) != 1) {
+            fprintf(stderr, "%s: truncated after %d of %llu records\n", path, i, (unsigned long long)header.process_count);
+            free(pid);
+            fclose(file);
+            return false;
+        }
+
+        // pid  (gantt chart 0 Idle)
+        if (r.pid <= 0 || r.arrival_time < 0 || r.cpu_burst < 2 || r.io_burst < 1 || r.io_request_time < 1 || r.io_request_time >= r.cpu_burst ||
+            (int64_t)r.arrival_time + r.cpu_burst + r.io_burst > (int64_t)MAX_ARRIVAL_TIME + 2 * MAX_BURST) {
+            fprintf(stderr, "%s: invalid process record %d\n", path, i);
+            free(pid);
+            fclose(file);
+            return false;
+        }
+
+        pid[i] = r.pid;
+
+        p->pid = r.pid;
+        p->priority = r.priority;
+        p->arrival_time = r.arrival_time;
+        p->cpu_burst = r.cpu_burst;
+        p->io_burst = r.io_burst;
+        p->io_request_time = r.io_request_time;
+    }
+
+    fclose(file);
+
+    int32_t duplicate = find_duplicate_pid(pid, process_count);
+    free(pid);
+
+    if (duplicate) {
+        fprintf(stderr, "%s: duplicate pid %d\n", path, duplicate);
+        return false;
+    }
+
+    return true;
+}
+
+// ˰򸶴 process , Ϸ     پ  (compare_engines.sh main --dump )
+//   I/O ǥÿ   process    ļ 
+void dump_schedules() {
+    for (int k = 0; k < SCHEDULER_COUNT; k++) {
+        initialization();
+        scheduler_run[k]();
+
+        printf("policy %s\n", scheduler_name[k]);
+
+        for (int i = 0; i < process_count; i++) {
+            printf("process %d %d %d\n", process_list[i].pid, process_list[i].start_time, process_list[i].completion_time);
+        }
+
+        int j = 0;
+
+        while (j < gantt_count) {
+            Gantt_Interval* g = &gantt[j++];
+            int end = g->end;
+
+            while (j < gantt_count && gantt[j].pid == g->pid && gantt[j].start == end) {
+                end = gantt[j++].end;
+            }
+
+            printf("run %d %d %d\n", g->start, end, g->pid);
+        }
+    }
 }